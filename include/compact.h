@@ -0,0 +1,182 @@
+#ifndef compact_h
+#define compact_h
+
+/* ================================================================ */
+
+/**
+ * \brief Creates a new compact singly-linked list.
+ *
+ * A compact list keeps its nodes in one array owned by the list and links them by 32-bit indices.
+ * A node takes 16 bytes and no separate allocation, about half the memory of an \ref sList_t node, and nodes
+ * that are close in the list tend to be close in memory. Nodes are referred to by \ref sCNode_t handles,
+ * which remain valid while the pool grows and go stale once their node is removed.
+ *
+ * \param[out] list A pointer to store the new list.
+ * \param[in] capacity The number of nodes to reserve room for; the pool grows on demand. 0 picks a small default.
+ * \param[in] destroy A user-defined function to free the data stored in each node when the list is destroyed.
+ *                For more information, see the documentation for the \ref methods struct.
+ * \param[in] match A user-defined function to compare the data in the list with a user-defined key.
+ *                For more information, see the documentation for the \ref methods struct.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sCList_new(sCList_t* list, size_t capacity, void (*destroy)(void* data), int (*match)(void* data_1, void* data_2));
+
+/* ================================ */
+
+/**
+ * \brief Destroys a compact list, calling `destroy` on the data of every node.
+ *
+ * \param[in] list A pointer to the list to be destroyed. Upon return the list is `NULL`.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sCList_destroy(sCList_t* list);
+
+/* ================================ */
+
+/**
+ * \brief Inserts data at the end of a compact list.
+ *
+ * \param[in] list A compact list.
+ * \param[in] data A pointer to the data to be stored in the new node.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sCList_insert_last(const sCList_t list, void* data);
+
+/* ================================ */
+
+/**
+ * \brief Inserts data at the beginning of a compact list.
+ *
+ * \param[in] list A compact list.
+ * \param[in] data A pointer to the data to be stored in the new node.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sCList_insert_first(const sCList_t list, void* data);
+
+/* ================================ */
+
+/**
+ * \brief Inserts data after a given node of a compact list.
+ *
+ * \param[in] list A compact list.
+ * \param[in] node A handle to the node after which the data will be inserted.
+ * \param[in] data A pointer to the data to be inserted.
+ *
+ * \return 0 on success, `E_MATCH` if the handle does not refer to a node of the list, another non-zero value otherwise.
+ */
+extern int sCList_insert_after(const sCList_t list, sCNode_t node, void* data);
+
+/* ================================ */
+
+/**
+ * \brief Removes the first node of a compact list and stores its data in `data`.
+ *
+ * \param[in] list A compact list.
+ * \param[out] data A pointer to store the data.
+ *
+ * \return 0 on success, `E_NOTFOUND` if the list is empty, another non-zero value otherwise.
+ *
+ * \remark The caller is responsible for destroying the data to prevent memory leaks.
+ */
+extern int sCList_remove_first(const sCList_t list, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Removes the last node of a compact list and stores its data in `data`.
+ *
+ * \param[in] list A compact list.
+ * \param[out] data A pointer to store the data.
+ *
+ * \return 0 on success, `E_NOTFOUND` if the list is empty, another non-zero value otherwise.
+ *
+ * \remark The caller is responsible for destroying the data to prevent memory leaks.
+ */
+extern int sCList_remove_last(const sCList_t list, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Removes a given node from a compact list and stores its data in `data`.
+ *
+ * \param[in] list A compact list.
+ * \param[in] node A handle to the node to be removed.
+ * \param[out] data A pointer to store the data.
+ *
+ * \return 0 on success, `E_MATCH` if the handle does not refer to a node of the list, another non-zero value otherwise.
+ *
+ * \remark The caller is responsible for destroying the data to prevent memory leaks.
+ */
+extern int sCList_delete_Node(const sCList_t list, sCNode_t node, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Searches a compact list for a node matching the given data.
+ *
+ * \param[in] list A compact list.
+ * \param[in] data A pointer to the data to be searched for.
+ * \param[out] node A pointer to store a handle to the node.
+ *
+ * \return 0 on success, `E_NOTFOUND` if no node matches, another non-zero value otherwise.
+ */
+extern int sCList_find(const sCList_t list, void* data, sCNode_t* node);
+
+/* ================================ */
+
+/**
+ * \brief Retrieves the data of the node a handle refers to.
+ *
+ * \param[in] list A compact list.
+ * \param[in] node A handle to a node of the list.
+ * \param[out] data A pointer to store the data.
+ *
+ * \return 0 on success, `E_MATCH` if the handle does not refer to a node of the list, another non-zero value otherwise.
+ */
+extern int sCList_get(const sCList_t list, sCNode_t node, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Applies a specified function to the data of every node of a compact list.
+ *
+ * \param[in] list A compact list.
+ * \param[in] func A function pointer to the function to be applied to each node's data.
+ *
+ * \return Upon successful execution, the function returns the sum of the values returned by `func`; a non-zero value otherwise.
+ */
+extern int sCList_foreach(const sCList_t list, int (*func)(void* data));
+
+/* ================================ */
+
+/**
+ * \brief Returns the size of a compact list.
+ *
+ * \param[in] list A compact list.
+ *
+ * \return The size of the list, or -1 otherwise.
+ */
+extern ssize_t sCList_size(const sCList_t list);
+
+/* ================================ */
+
+/**
+ * \brief Checks if a handle refers to a node of a given compact list.
+ *
+ * Instead of a reference stored in every node, the check compares the pool id and the slot generation
+ * encoded in the handle with those of the list.
+ *
+ * \param[in] node A handle to a node.
+ * \param[in] list A compact list.
+ *
+ * \return Returns 0 if the node belongs to the list, 1 if it does not, and -1 if the list is `NULL`.
+ */
+extern int sCNode_belongs(sCNode_t node, const sCList_t list);
+
+/* ================================================================ */
+
+#endif /* compact_h */
@@ -0,0 +1,526 @@
+#ifndef coro_hpp
+#define coro_hpp
+
+/*
+ * A C++20 coroutine layer over lists in sync mode, see \ref sList_set_sync. Header-only: it needs nothing
+ * from the library beyond `sll.h`, and a compiler run with `-std=c++20`.
+ *
+ * Coroutines wait for elements with `co_await queue.pop()` instead of blocking a thread each. Waiting coroutines
+ * are resumed by whichever thread hands out elements: \ref sll::queue::push, \ref sll::queue::dispatch, called
+ * e.g. from an event loop when the list's eventfd is readable, or a single thread running \ref sll::queue::serve.
+ */
+
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <stop_token>
+#include <utility>
+
+#include "sll.h"
+
+namespace sll {
+
+/* ================================================================ */
+
+/**
+ * \brief A list in sync mode whose elements are consumed by coroutines.
+ *
+ * The queue does not own the list: producers may keep inserting with \ref sList_insert_last from C code, and the
+ * list must outlive the queue. Every coroutine still waiting must be resumed, e.g. with \ref close, before the
+ * queue is destroyed.
+ */
+class queue {
+
+    /**
+     * A coroutine waiting in \ref pop, linked into the queue's FIFO of waiters.
+     */
+    struct waiter {
+
+        std::coroutine_handle<> handle;
+
+        void* data = nullptr;       /**< The element handed to the coroutine, `nullptr` once the queue is closed */
+
+        waiter* next = nullptr;
+    };
+
+public:
+
+    /**
+     * \brief The awaitable returned by \ref pop; `co_await` yields the element's data, `nullptr` if the queue was closed.
+     */
+    class pop_awaiter {
+
+    public:
+
+        explicit pop_awaiter(queue& owner) : owner_(owner) {}
+
+        bool await_ready() {
+            return owner_.try_pop(waiter_.data);
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle) {
+
+            waiter_.handle = handle;
+
+            return owner_.wait(&waiter_);
+        }
+
+        void* await_resume() const noexcept {
+            return waiter_.data;
+        }
+
+    private:
+
+        queue& owner_;
+        waiter waiter_;
+    };
+
+    /* ================================ */
+
+    /**
+     * \brief Wraps a list, switching it to sync mode.
+     *
+     * \param[in] list A singly-linked list.
+     *
+     * \throw std::bad_alloc If the list cannot be switched to sync mode for lack of memory.
+     * \throw std::invalid_argument If `list` is `NULL`.
+     */
+    explicit queue(sList_t list) : list_(list) {
+
+        switch (sList_set_sync(list_)) {
+
+            case E_OK:
+                break ;
+
+            case E_NOMEM:
+                throw std::bad_alloc();
+
+            default:
+                throw std::invalid_argument("sll::queue: no list to wrap");
+        }
+    }
+
+    queue(const queue&) = delete;
+    queue& operator=(const queue&) = delete;
+
+    /* ================================ */
+
+    /**
+     * \brief Removes the first element of the list, suspending the calling coroutine while the list is empty.
+     */
+    pop_awaiter pop() {
+        return pop_awaiter(*this);
+    }
+
+    /* ================================ */
+
+    /**
+     * \brief Inserts data at the end of the list and hands out what waiting coroutines can take, resuming them on this thread.
+     *
+     * \return 0 on success, a non-zero value otherwise, see \ref sList_insert_last.
+     */
+    int push(void* data) {
+
+        int result = sList_insert_last(list_, data);
+
+        dispatch();
+
+        return result;
+    }
+
+    /* ================================ */
+
+    /**
+     * \brief Hands elements to waiting coroutines, in the order they started waiting, and resumes them on this thread.
+     *
+     * Never blocks, so it fits an event loop watching the list's eventfd, see \ref sList_eventfd.
+     *
+     * \return The number of coroutines resumed.
+     */
+    size_t dispatch() {
+
+        size_t count = 0;
+
+        for (waiter* w = nullptr; (w = take_ready()) != nullptr; count++) {
+            w->handle.resume();
+        }
+
+        return count;
+    }
+
+    /* ================================ */
+
+    /**
+     * \brief Serves waiting coroutines until a stop is requested, sleeping while there is nothing to do.
+     *
+     * One thread running this can serve any number of coroutines; they are resumed on it. It may run next to
+     * threads calling \ref push or \ref dispatch, and to C consumers of the list.
+     *
+     * \param[in] stop A token a stop is requested through, e.g. that of a `std::jthread`.
+     */
+    void serve(std::stop_token stop) {
+
+        while (!stop.stop_requested()) {
+
+            waiter* w = nullptr;
+
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+
+                if (!waiting_.wait(lock, stop, [this] { return first_ != nullptr; })) {
+                    break ;
+                }
+
+                /* The waiter is claimed before an element is taken for it, so no element leaves the list without a coroutine to go to */
+                w = unlink_first();
+            }
+
+            /* The timeout bounds how long a stop request goes unnoticed */
+            if (sList_pop_wait(list_, &w->data, 100) == E_OK) {
+                w->handle.resume();
+
+                continue ;
+            }
+
+            /* Nothing came: the waiter goes back to the front, unless `close`, which did not see it, ended the wait */
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                if (!closed_) {
+
+                    if ((w->next = first_) == nullptr) {
+                        last_ = w;
+                    }
+
+                    first_ = w;
+                    w = nullptr;
+                }
+            }
+
+            if (w != nullptr) {
+                w->data = nullptr;
+                w->handle.resume();
+            }
+        }
+
+        return ;
+    }
+
+    /* ================================ */
+
+    /**
+     * \brief Resumes every waiting coroutine with `nullptr`; later pops of an empty list return `nullptr` right away.
+     */
+    void close() {
+
+        waiter* w = nullptr;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            closed_ = true;
+
+            w = first_;
+            first_ = last_ = nullptr;
+        }
+
+        waiting_.notify_all();
+
+        while (w != nullptr) {
+            waiter* next = w->next;
+
+            w->data = nullptr;
+            w->handle.resume();
+
+            w = next;
+        }
+
+        return ;
+    }
+
+    /* ================================ */
+
+    /**
+     * \brief Returns the list.
+     */
+    sList_t list() const noexcept {
+        return list_;
+    }
+
+private:
+
+    /**
+     * \brief Removes the first element without waiting.
+     *
+     * \return `true` if `data` holds an element, or `nullptr` because the queue is closed.
+     */
+    bool try_pop(void*& data) {
+
+        if (sList_pop_wait(list_, &data, 0) == E_OK) {
+            return true;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        data = nullptr;
+
+        return closed_;
+    }
+
+    /* ================================ */
+
+    /**
+     * \brief Queues a coroutine, unless an element arrived or the queue was closed since it last looked.
+     *
+     * \return `true` if the coroutine has to suspend.
+     */
+    bool wait(waiter* w) {
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            if (closed_) {
+                w->data = nullptr;
+
+                return false;
+            }
+
+            /* Checked under the lock, so an element inserted before the coroutine is queued is not missed by `dispatch` */
+            if (sList_pop_wait(list_, &w->data, 0) == E_OK) {
+                return false;
+            }
+
+            if (last_ == nullptr) {
+                first_ = last_ = w;
+            }
+            else {
+                last_->next = w;
+                last_ = w;
+            }
+        }
+
+        waiting_.notify_one();
+
+        return true;
+    }
+
+    /* ================================ */
+
+    /**
+     * \brief Takes the first waiter off the FIFO, which must not be empty; `mutex_` must be held.
+     */
+    waiter* unlink_first() {
+
+        waiter* w = first_;
+
+        if ((first_ = w->next) == nullptr) {
+            last_ = nullptr;
+        }
+
+        return w;
+    }
+
+    /* ================================ */
+
+    /**
+     * \brief Takes the first waiter off the FIFO together with an element for it, `nullptr` if either is missing.
+     */
+    waiter* take_ready() {
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        waiter* w = first_;
+
+        if ((w == nullptr) || (sList_pop_wait(list_, &w->data, 0) != E_OK)) {
+            return nullptr;
+        }
+
+        return unlink_first();
+    }
+
+    /* ================================ */
+
+    sList_t list_;
+
+    std::mutex mutex_;
+    std::condition_variable_any waiting_;     /**< Notified when a coroutine starts waiting or the queue is closed */
+
+    waiter* first_ = nullptr;
+    waiter* last_ = nullptr;
+
+    bool closed_ = false;
+};
+
+/* ================================================================ */
+
+/**
+ * \brief A coroutine that produces values asynchronously: its body may `co_await`, and it hands values out with `co_yield`.
+ *
+ * Consumers take values with `co_await generator.next()`, which yields `std::nullopt` once the body has returned.
+ * The body runs only while a consumer is waiting for its next value, and is resumed on the thread that resumes
+ * what it awaits.
+ */
+template <typename T>
+class async_generator {
+
+public:
+
+    struct promise_type;
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    /**
+     * Resumes the consumer waiting in \ref next once the body yields a value or returns.
+     */
+    struct consumer_awaiter {
+
+        bool await_ready() const noexcept {
+            return false;
+        }
+
+        std::coroutine_handle<> await_suspend(handle_type handle) const noexcept {
+            return handle.promise().consumer;
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    struct promise_type {
+
+        std::optional<T> value;
+        std::exception_ptr exception;
+
+        std::coroutine_handle<> consumer;
+
+        async_generator get_return_object() noexcept {
+            return async_generator(handle_type::from_promise(*this));
+        }
+
+        std::suspend_always initial_suspend() const noexcept {
+            return {};
+        }
+
+        consumer_awaiter final_suspend() const noexcept {
+            return {};
+        }
+
+        consumer_awaiter yield_value(T v) {
+
+            value.emplace(std::move(v));
+
+            return {};
+        }
+
+        void return_void() noexcept {}
+
+        void unhandled_exception() noexcept {
+            exception = std::current_exception();
+        }
+    };
+
+    /**
+     * The awaitable returned by \ref next.
+     */
+    class next_awaiter {
+
+    public:
+
+        explicit next_awaiter(handle_type handle) : handle_(handle) {}
+
+        bool await_ready() const noexcept {
+            return handle_.done();
+        }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> consumer) noexcept {
+
+            handle_.promise().consumer = consumer;
+            handle_.promise().value.reset();
+
+            return handle_;
+        }
+
+        std::optional<T> await_resume() {
+
+            if (handle_.promise().exception) {
+                std::rethrow_exception(std::exchange(handle_.promise().exception, nullptr));
+            }
+
+            return std::move(handle_.promise().value);
+        }
+
+    private:
+
+        handle_type handle_;
+    };
+
+    /* ================================ */
+
+    async_generator(async_generator&& other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {}
+
+    async_generator& operator=(async_generator&& other) noexcept {
+
+        if (this != &other) {
+
+            if (handle_) {
+                handle_.destroy();
+            }
+
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+
+        return *this;
+    }
+
+    ~async_generator() {
+
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    /**
+     * \brief Runs the body up to its next value; must not be called again before the previous `co_await` has completed.
+     */
+    next_awaiter next() {
+        return next_awaiter(handle_);
+    }
+
+private:
+
+    explicit async_generator(handle_type handle) : handle_(handle) {}
+
+    handle_type handle_;
+};
+
+/* ================================ */
+
+/**
+ * \brief Streams the elements of a queue as they arrive, until the queue is closed.
+ *
+ * \param[in] q A queue.
+ *
+ * \return A generator yielding the data of every element taken off the queue.
+ */
+inline async_generator<void*> stream(queue& q) {
+
+    for (;;) {
+
+        void* data = co_await q.pop();
+
+        if (data == nullptr) {
+            co_return;
+        }
+
+        co_yield data;
+    }
+}
+
+/* ================================================================ */
+
+} /* namespace sll */
+
+#endif /* coro_hpp */
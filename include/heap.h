@@ -0,0 +1,152 @@
+#ifndef heap_h
+#define heap_h
+
+/* ================================================================ */
+
+/**
+ * \brief Creates a new priority queue.
+ *
+ * The queue is a pairing heap: inserting and merging take constant time, removing the minimum takes
+ * logarithmic amortized time. Elements are ordered by `compare`, which plays the part `match` plays for
+ * a list: `compare(data_1, data_2)` returns a negative value if `data_1` comes before `data_2`, a positive value
+ * if it comes after it, and 0 if either may come first.
+ *
+ * \param[out] heap A pointer to store the new queue.
+ * \param[in] destroy A user-defined function to free the data left in the queue when it is destroyed.
+ *                For more information, see the documentation for the \ref methods struct.
+ * \param[in] compare A user-defined function that orders data.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sHeap_new(sHeap_t* heap, void (*destroy)(void* data), int (*compare)(void* data_1, void* data_2));
+
+/* ================================ */
+
+/**
+ * \brief Destroys a priority queue, calling `destroy` on the data of every element.
+ *
+ * \param[in] heap A pointer to the queue to be destroyed. Upon return the queue is `NULL`.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sHeap_destroy(sHeap_t* heap);
+
+/* ================================ */
+
+/**
+ * \brief Inserts data into a priority queue.
+ *
+ * \param[in] heap A priority queue.
+ * \param[in] data A pointer to the data to be inserted.
+ * \param[out] node A pointer to store a handle to the new element, for \ref sHeap_decrease_key and \ref sHeap_remove;
+ *                 may be `NULL`.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sHeap_insert(const sHeap_t heap, void* data, sHNode_t* node);
+
+/* ================================ */
+
+/**
+ * \brief Retrieves the first element of a priority queue without removing it.
+ *
+ * \param[in] heap A priority queue.
+ * \param[out] data A pointer to store the data.
+ *
+ * \return 0 on success, `E_NOTFOUND` if the queue is empty, another non-zero value otherwise.
+ */
+extern int sHeap_peek_min(const sHeap_t heap, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Removes the first element of a priority queue and stores its data in `data`.
+ *
+ * \param[in] heap A priority queue.
+ * \param[out] data A pointer to store the data.
+ *
+ * \return 0 on success, `E_NOTFOUND` if the queue is empty, another non-zero value otherwise.
+ *
+ * \remark The caller is responsible for destroying the data to prevent memory leaks. Handles to the element go stale.
+ */
+extern int sHeap_pop_min(const sHeap_t heap, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Moves an element of a priority queue forward after its key has decreased.
+ *
+ * The element's data is replaced with `data`, which may be the same pointer if the key was changed in place.
+ *
+ * \param[in] heap A priority queue.
+ * \param[in] node A handle to an element of the queue, obtained from \ref sHeap_insert.
+ * \param[in] data The element's new data.
+ *
+ * \return 0 on success, `E_MATCH` if the handle refers to an element that has been removed, `E_INVAL` if the new data
+ *         comes after the old one, another non-zero value otherwise.
+ *
+ * \warning The handle must come from this queue, or from one merged into it: a handle to an element of another
+ *          queue is not detected.
+ */
+extern int sHeap_decrease_key(const sHeap_t heap, sHNode_t node, void* data);
+
+/* ================================ */
+
+/**
+ * \brief Removes a given element of a priority queue and stores its data in `data`.
+ *
+ * \param[in] heap A priority queue.
+ * \param[in] node A handle to an element of the queue, obtained from \ref sHeap_insert.
+ * \param[out] data A pointer to store the data.
+ *
+ * \return 0 on success, `E_MATCH` if the handle refers to an element that has been removed, another non-zero value otherwise.
+ *
+ * \remark The caller is responsible for destroying the data to prevent memory leaks. Handles to the element go stale.
+ *
+ * \warning The handle must come from this queue, or from one merged into it, as for \ref sHeap_decrease_key.
+ */
+extern int sHeap_remove(const sHeap_t heap, sHNode_t node, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Moves every element of a priority queue into another one.
+ *
+ * \param[in] heap The queue the elements are moved into.
+ * \param[in] other A pointer to the queue the elements are taken from. Upon return the queue is `NULL`;
+ *                handles to its elements remain valid and now refer to elements of `heap`.
+ *
+ * \return 0 on success, `E_MISMET` if the queues do not share their `compare` and `destroy` methods, another non-zero value otherwise.
+ */
+extern int sHeap_merge(const sHeap_t heap, sHeap_t* other);
+
+/* ================================ */
+
+/**
+ * \brief Moves all data of a singly-linked list into a priority queue.
+ *
+ * The queue takes the data pointers, not copies of the data, into elements obtained with a single allocation,
+ * and orders them in linear time. The list is left empty.
+ *
+ * \param[in] heap A priority queue.
+ * \param[in] list A singly-linked list.
+ *
+ * \return 0 on success, `E_MISMET` if the list holds copies made by the `_copy` functions, which live in its nodes,
+ *         another non-zero value otherwise. On failure both containers are left as they were.
+ */
+extern int sHeap_heapify(const sHeap_t heap, const sList_t list);
+
+/* ================================ */
+
+/**
+ * \brief Returns the number of elements in a priority queue.
+ *
+ * \param[in] heap A priority queue.
+ *
+ * \return The size of the queue, or -1 otherwise.
+ */
+extern ssize_t sHeap_size(const sHeap_t heap);
+
+/* ================================================================ */
+
+#endif /* heap_h */
@@ -0,0 +1,54 @@
+#ifndef inline_h
+#define inline_h
+
+/*
+ * Inline definitions of trivial accessors, used when `SLL_INLINE` is defined. They let the compiler
+ * inline the list fast path into the caller instead of calling into the shared library through the PLT.
+ * The price is that the caller is compiled against the library's internal layout, so it must be rebuilt
+ * whenever the library is.
+ */
+
+/* ================================================================ */
+
+#include "internal.h"
+
+/* ================================================================ */
+
+static inline ssize_t sList_size(const sList_t list) {
+
+    if (list == NULL) {
+        return -E_NULL_V;
+    }
+
+    return list->data->size;
+}
+
+/* ================================ */
+
+static inline int sList_peek_first(const sList_t list, void** data) {
+
+    if ((list == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    *data = (list->data->size > 0) ? list->data->head->data : NULL;
+
+    return (*data != NULL) ? E_OK : E_NULL_V;
+}
+
+/* ================================ */
+
+static inline int sList_peek_last(const sList_t list, void** data) {
+
+    if ((list == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    *data = (list->data->size > 0) ? list->data->tail->data : NULL;
+
+    return (*data != NULL) ? E_OK : E_NULL_V;
+}
+
+/* ================================================================ */
+
+#endif /* inline_h */
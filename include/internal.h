@@ -0,0 +1,310 @@
+#ifndef internal_h
+#define internal_h
+
+/*
+ * Definitions shared by the library's modules. Users interact with lists only through the functions
+ * declared in the public headers; `sll.h` includes this header only when `SLL_INLINE` is defined.
+ */
+
+/* ================================================================ */
+
+/**
+ * 
+ */
+struct singly_linked_list_node {
+
+    sNode_t next;   /**< A pointer to the next node in a singly-linked list */
+
+    void* data;     /**< Node's data */
+
+    sList_t list;   /**< The list a node belongs to */
+};
+
+/**
+ * The `methods` struct encapsulates all the methods available for a list.
+ * It serves as a container for the function pointers that define the behavior and operations supported by the list,
+ * providing a unified interface to interact with the list's functionality.
+ * 
+ * The methods struct is defined as an incomplete data type, 
+ * which means that its function pointers are not specified within the struct definition.
+ * Instead, the function pointers are defined separately in the code where the methods struct is used.
+ */
+struct methods {
+
+    /**
+     * \brief Provides a way to free dynamically allocated data when \link sList_destroy \endlink is called.
+     * 
+     * Provides a way to free dynamically allocated data when \link sList_destroy \endlink is called.
+     * For example, if the list contains data dynamically allocated using `malloc`,
+     * destroy should be set to `free` to free the data as the linked list is destroyed. 
+     * For structured data containing several dynamically allocated members, `destroy` should be set to a user-defined function
+     * that calls `free` for each dynamically allocated member as well as for the structure itself.
+     * For a linked list containing data that should not be freed, `destroy` should be set to `NULL`.
+     * 
+     * @param[in] data Node's data
+     * 
+     * \return None
+     */
+    void (*destroy)(void* data);
+
+    /**
+     * \brief Provides a way to account for the memory held by Node's data.
+     * 
+     * The `payload` method is an optional user-defined function, set with \link sList_set_payload \endlink, that reports
+     * how many bytes the data owns, so they count towards the list's \link sList_bytes \endlink and its byte limit.
+     * It must report the same number for the same data for as long as the data is in the list.
+     * Data copied into the list by the `_copy` functions is accounted for without it.
+     * 
+     * @param[in] data Node's data.
+     * 
+     * \return The number of bytes held by the data.
+     */
+    size_t (*payload)(void* data);
+
+    /**
+     * \brief Provides a way to display Node's data.
+     * 
+     * The `print` method is used to output the data held by each node in the singly-linked list.
+     * It does this by traversing the list and calling the user-defined `print` function for each node's data.
+     * 
+     * @param[in] data Node's data.
+     * 
+     * \return None.
+    */
+    void (*print)(void* data);
+
+    /**
+     * \brief Provides a way to compare data stored in a node.
+     * 
+     * The `match` method is a user-defined function that compares the data held by a node with arbitrary data.
+     * 
+     * @param[in] data_1 The data held by the node
+     * @param[in] data_2 The data to be compared with the node's data.
+     * 
+     * \return `0` if the two values are equal, indicating a successful match; any non-zero value if the two values are not equal, indicating a mismatch.
+     */
+    int (*match)(void* data_1, void* data_2);
+
+    /**
+     * \brief Provides a way to hash data stored in a node.
+     * 
+     * The `hash` method is an optional user-defined function, set with \link sList_set_hash \endlink, that lets operations
+     * comparing every node with every other one, such as \link sList_unique \endlink, use a hash table instead.
+     * Data that `match` considers equal must hash equally.
+     * 
+     * @param[in] data Node's data.
+     * 
+     * \return The hash of the data.
+     */
+    size_t (*hash)(void* data);
+};
+
+/**
+ * A singly-linked list data.
+ */
+struct data {
+    ssize_t size;   /**< Number of elements in a singly-linked list */
+
+    sNode_t head;   /**< The first node of the singly-linked list */
+    sNode_t tail;   /**< The last node of the singly-linked list */
+
+    struct snapshot* snapshot;  /**< The snapshot readers currently get from \ref sList_snapshot, `NULL` if none was published */
+
+    sAllocator_t allocator;     /**< Where the list's nodes and the list itself come from */
+
+    sNode_t finger;             /**< The node last reached by position, `NULL` if unknown */
+    ssize_t finger_index;       /**< The position of `finger` */
+
+    struct sync* sync;          /**< The lock and the wake-up state of a list in sync mode, `NULL` otherwise */
+
+    size_t bytes;               /**< Memory held by the nodes and, through the `payload` method, by their data */
+    size_t max_size;            /**< The most elements the list takes, 0 for no limit */
+    size_t max_bytes;           /**< The most `bytes` the list takes, 0 for no limit */
+    int block;                  /**< Non-zero if inserting into a full list in sync mode waits for room */
+
+    struct bloom* bloom;        /**< A filter that rules out most data not in the list before \ref sList_find walks it, `NULL` if none */
+};
+
+/* ================================ */
+
+/*
+ * Flags kept in the low bits of a node's `list` pointer, which is at least 8-byte aligned.
+ * They cost no space in the node.
+ */
+#define NODE_FLAGS      ((uintptr_t) 7)
+
+/* The node and its data share one allocation, which starts at `data`; see \ref sList_insert_last_copy */
+#define NODE_INLINE     ((uintptr_t) 1)
+
+/* The node is one of a block of nodes allocated together, see \ref sList_clone; it is a \ref block_node */
+#define NODE_BLOCK      ((uintptr_t) 2)
+
+/**
+ * The header of a block of nodes allocated together. The nodes follow it, and the block goes back to the
+ * allocator when its last node is released, whichever lists its nodes have ended up in.
+ */
+struct node_block {
+    size_t live;    /**< Nodes of the block not released yet */
+};
+
+/**
+ * A node allocated as part of a block. It is no larger than what `malloc` hands out for a plain node.
+ */
+struct block_node {
+
+    struct singly_linked_list_node node;
+
+    struct node_block* block;   /**< The block the node is part of */
+};
+
+/**
+ * \brief Returns the list a node belongs to.
+ */
+static inline sList_t Node_list(const sNode_t node) {
+    return (sList_t) ((uintptr_t) node->list & ~NODE_FLAGS);
+}
+
+/**
+ * \brief Marks a node as belonging to a given list, keeping its flags.
+ */
+static inline void Node_set_list(const sNode_t node, const sList_t list) {
+    node->list = (sList_t) ((uintptr_t) list | ((uintptr_t) node->list & NODE_FLAGS));
+}
+
+/**
+ * \brief Tells whether a node's data is stored in the node's own allocation.
+ */
+static inline int Node_is_inline(const sNode_t node) {
+    return ((uintptr_t) node->list & NODE_INLINE) != 0;
+}
+
+/**
+ * \brief Tells whether a node is part of a block of nodes.
+ */
+static inline int Node_in_block(const sNode_t node) {
+    return ((uintptr_t) node->list & NODE_BLOCK) != 0;
+}
+
+/* ================================ */
+
+/**
+ * \brief Releases memory obtained from an allocator.
+ */
+static inline void Allocator_free(const sAllocator_t* allocator, void* pointer) {
+
+    if (allocator->free != NULL) {
+        allocator->free(allocator->context, pointer);
+    }
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * \brief Releases the memory of a node that does not share its allocation with its data.
+ *
+ * A node that is part of a block releases its share of the block; the last one frees it.
+ */
+static inline void Node_release(const sAllocator_t* allocator, const sNode_t node) {
+
+    struct node_block* block = NULL;
+
+    if (Node_in_block(node)) {
+        block = ((struct block_node*) node)->block;
+
+        /* Nodes of one block may have been moved to lists owned by other threads */
+        if (__atomic_sub_fetch(&block->live, 1, __ATOMIC_ACQ_REL) == 0) {
+            Allocator_free(allocator, block);
+        }
+    }
+    else {
+        Allocator_free(allocator, node);
+    }
+
+    return ;
+}
+
+/* ================================ */
+
+/*
+ * Functions shared by the library's modules are kept out of the shared library's exported symbols,
+ * so their generic names cannot clash with those of a program linking it.
+ */
+#define SLL_INTERNAL    __attribute__((visibility("hidden")))
+
+/**
+ * \brief Drops a reference to a snapshot, freeing it and destroying the data retired with it once unreferenced.
+ * 
+ * @param[in] snapshot A snapshot, `NULL` is ignored.
+ */
+extern SLL_INTERNAL void Snapshot_drop(struct snapshot* snapshot);
+
+/**
+ * \brief Defers the destruction of data until no reader can hold a snapshot that refers to it.
+ * 
+ * @param[in] snapshot The snapshot currently published by the list the data has been removed from.
+ * @param[in] data Data removed from the list.
+ * @param[in] destroy The function that destroys the data, `NULL` to release it through `allocator`.
+ * @param[in] allocator The allocator a copy made by the `_copy` functions came from, used when `destroy` is `NULL`.
+ * 
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern SLL_INTERNAL int Snapshot_retire(struct snapshot* snapshot, void* data, void (*destroy)(void* data), const sAllocator_t* allocator);
+
+/**
+ * \brief Publishes a list that takes over elements of a published list, so their data outlives its readers.
+ * 
+ * The new list is published while still empty, and its snapshot is kept alive by the one the other list has
+ * published: data the new list lets go of is retired until no reader can hold a snapshot that refers to it.
+ * Nothing is done if the other list has never been published.
+ * 
+ * @param[in] list The list the elements come from.
+ * @param[in] out A new, empty list the elements will be moved to.
+ * 
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern SLL_INTERNAL int Snapshot_inherit(const sList_t list, const sList_t out);
+
+/* ================================ */
+
+/**
+ * \brief Finds the node at a given position of a list.
+ * 
+ * The walk starts from the finger, the node last reached this way, when it does not lie past the position,
+ * so reaching consecutive positions takes constant time each. The node found becomes the new finger.
+ * 
+ * @param[in] list A singly-linked list.
+ * @param[in] index A position, less than the size of the list.
+ * @param[out] nodes A pointer to store the number of nodes the walk went through, for tracing; may be `NULL`.
+ * 
+ * \return The node.
+ */
+extern SLL_INTERNAL sNode_t Node_at(const sList_t list, ssize_t index, size_t* nodes);
+
+/* ================================ */
+
+/**
+ * \brief Tells whether an allocator is the one of lists created by \ref sList_new, `malloc` and `free`.
+ * 
+ * Copies made by the `_copy` functions from such an allocator are released like any other data, by the `destroy`
+ * method or with `free`; copies from a custom allocator can only go back to that allocator.
+ * 
+ * @param[in] allocator An allocator.
+ * 
+ * \return Non-zero for the default allocator, 0 otherwise.
+ */
+extern SLL_INTERNAL int Allocator_is_default(const sAllocator_t* allocator);
+
+/* ================================ */
+
+/**
+ * \brief Resets the state of \ref sList_next if it refers to a given list, which is about to be destroyed.
+ * 
+ * @param[in] list A singly-linked list.
+ */
+extern SLL_INTERNAL void Iterator_forget(const sList_t list);
+
+/* ================================================================ */
+
+#endif /* internal_h */
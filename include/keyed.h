@@ -0,0 +1,113 @@
+#ifndef keyed_h
+#define keyed_h
+
+/* ================================================================ */
+
+/**
+ * \brief Creates a new keyed list.
+ *
+ * A keyed list stores data together with a 32-bit key, in chunks that hold the keys of up to 64 elements
+ * next to each other and their data pointers in a separate array. A lookup by key compares a whole chunk of keys
+ * at once with AVX2 or SSE2 instructions, picked when the list is created according to what the CPU supports,
+ * or with plain comparisons on other architectures; it neither calls a `match` method nor touches the data.
+ * Removing an element merges its chunk with a neighbour when their elements fit in one chunk.
+ *
+ * \param[out] list A pointer to store the new list.
+ * \param[in] destroy A user-defined function to free the data stored in the list when it is destroyed.
+ *                For more information, see the documentation for the \ref methods struct.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sKList_new(sKList_t* list, void (*destroy)(void* data));
+
+/* ================================ */
+
+/**
+ * \brief Destroys a keyed list, calling `destroy` on the data of every element.
+ *
+ * \param[in] list A pointer to the list to be destroyed. Upon return the list is `NULL`.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sKList_destroy(sKList_t* list);
+
+/* ================================ */
+
+/**
+ * \brief Inserts data with a given key at the end of a keyed list.
+ *
+ * \param[in] list A keyed list.
+ * \param[in] key The key of the data; keys do not have to be unique.
+ * \param[in] data A pointer to the data.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sKList_insert_last(const sKList_t list, uint32_t key, void* data);
+
+/* ================================ */
+
+/**
+ * \brief Inserts data with a given key at the beginning of a keyed list.
+ *
+ * \param[in] list A keyed list.
+ * \param[in] key The key of the data; keys do not have to be unique.
+ * \param[in] data A pointer to the data.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sKList_insert_first(const sKList_t list, uint32_t key, void* data);
+
+/* ================================ */
+
+/**
+ * \brief Searches a keyed list for the first element with a given key.
+ *
+ * \param[in] list A keyed list.
+ * \param[in] key The key to look for.
+ * \param[out] data A pointer to store the data of the element.
+ *
+ * \return 0 on success, `E_NOTFOUND` if no element has the key, another non-zero value otherwise.
+ */
+extern int sKList_find(const sKList_t list, uint32_t key, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Removes the first element with a given key and stores its data in `data`.
+ *
+ * \param[in] list A keyed list.
+ * \param[in] key The key to look for.
+ * \param[out] data A pointer to store the data.
+ *
+ * \return 0 on success, `E_NOTFOUND` if no element has the key, another non-zero value otherwise.
+ *
+ * \remark The caller is responsible for destroying the data to prevent memory leaks.
+ */
+extern int sKList_remove(const sKList_t list, uint32_t key, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Applies a specified function to the data of every element of a keyed list, in list order.
+ *
+ * \param[in] list A keyed list.
+ * \param[in] func A function pointer to the function to be applied to each element's data.
+ *
+ * \return Upon successful execution, the function returns the sum of the values returned by `func`; a non-zero value otherwise.
+ */
+extern int sKList_foreach(const sKList_t list, int (*func)(void* data));
+
+/* ================================ */
+
+/**
+ * \brief Returns the size of a keyed list.
+ *
+ * \param[in] list A keyed list.
+ *
+ * \return The size of the list, or -1 otherwise.
+ */
+extern ssize_t sKList_size(const sKList_t list);
+
+/* ================================================================ */
+
+#endif /* keyed_h */
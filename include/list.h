@@ -40,6 +40,31 @@ extern int sList_new(sList_t* list, void (*destroy)(void* data), void (*print)(v
 
 /* ================================ */
 
+/**
+ * \brief Creates a new instance of a singly-linked list whose memory comes from a user-provided allocator.
+ * 
+ * The list, its nodes and the copies made by the `_copy` functions are all obtained from `allocator->alloc`
+ * and released through `allocator->free`, which lets a list live in an arena or a per-thread pool. The
+ * allocator is copied into the list, so the struct does not need to outlive the call, but its `context` does.
+ * If the allocator hands out zero-filled memory, setting `zeroed` spares the list from clearing it again.
+ * 
+ * \param[out] list A pointer to a list type to store a new list.
+ * \param[in] destroy See \ref sList_new.
+ * \param[in] print See \ref sList_new.
+ * \param[in] match See \ref sList_new.
+ * \param[in] allocator The allocator to use, `NULL` for `malloc` and `free`.
+ * 
+ * \return 0 on success, `E_MISMET` if the allocator has no `alloc` function, another non-zero value otherwise.
+ * 
+ * \remark Data inserted with a `_copy` function into such a list and removed from it must be released with the
+ *         allocator's `free` rather than with `free`. Copies the list disposes of itself, e.g. when it is destroyed,
+ *         go back to the allocator without being passed to `destroy`, also when snapshots delay their release;
+ *         the allocator's `context` must then outlive the snapshots as well.
+ */
+extern int sList_new_with_allocator(sList_t* list, void (*destroy)(void* data), void (*print)(void* data), int (*match)(void* data_1, void* data_2), const sAllocator_t* allocator);
+
+/* ================================ */
+
 /**
  * \brief Destroys a singly-linked list and frees its associated memory.
  * 
@@ -58,16 +83,74 @@ extern int sList_destroy(sList_t* list);
 
 /* ================================ */
 
+/**
+ * \brief Destroys a singly-linked list, deferring the release of its nodes.
+ * 
+ * This function detaches all nodes from the list in constant time, frees the list itself and
+ * queues the nodes for reclamation. Queued nodes are freed, and the user-defined `destroy` function
+ * is called on their data, either by the background thread started with \ref sList_reclaim_start
+ * or by explicit calls to \ref sList_reclaim_step. This keeps the cost of tearing down large lists
+ * away from latency-sensitive threads.
+ * 
+ * \param[in] list A pointer to the singly-linked list to be destroyed.
+ * 
+ * \remark The `destroy` function may be called from another thread, after this function has returned.
+ *         If the nodes cannot be queued, the list is destroyed synchronously.
+ * 
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sList_destroy_async(sList_t* list);
+
+/* ================================ */
+
+/**
+ * \brief Frees nodes queued by \ref sList_destroy_async.
+ * 
+ * This function frees at most `budget` queued nodes, calling the `destroy` function of the list
+ * they came from on their data. It lets a thread reclaim memory incrementally, e.g. between requests,
+ * without running a background thread.
+ * 
+ * \param[in] budget The maximum number of nodes to free.
+ * 
+ * \return The number of nodes freed; 0 when nothing is queued.
+ */
+extern size_t sList_reclaim_step(size_t budget);
+
+/* ================================ */
+
+/**
+ * \brief Starts a background thread that frees nodes queued by \ref sList_destroy_async.
+ * 
+ * Calling this function while the thread is running has no effect.
+ * 
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sList_reclaim_start(void);
+
+/* ================================ */
+
+/**
+ * \brief Stops the background reclamation thread.
+ * 
+ * The thread frees all queued nodes before it stops; the function returns once it has done so.
+ * 
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sList_reclaim_stop(void);
+
+/* ================================ */
+
 /**
  * \brief Inserts a new node with the given data at the end of a singly-linked list.
  * 
  * This function inserts a new node with the provided data at the end of the
  * singly-linked list. The newly inserted node becomes the last node in the list.
+ * If the list has reached its limits, see \ref sList_set_limits, the function fails or waits for room.
  * 
  * \param[in] list A singly-linked list to insert the new node into.
  * \param[in] data A pointer to the data to be stored in the new node.
  * 
- * \return 0 on success, or a non-zero value otherwise.
+ * \return 0 on success, `E_FULL` if the list has no room for the element, or a non-zero value otherwise.
  */
 extern int sList_insert_last(const sList_t list, void* data);
 
@@ -89,6 +172,42 @@ extern int sList_insert_first(const sList_t list, void* data);
 
 /* ================================ */
 
+/**
+ * \brief Inserts a copy of the given bytes at the end of a singly-linked list.
+ * 
+ * This function copies `length` bytes into the same allocation as the new node, so small records need
+ * neither a separate allocation nor a pointer chase to reach them. The list owns the copy: it is freed
+ * together with the node when the list is destroyed, whether or not the list has a `destroy` method.
+ * 
+ * \param[in] list A singly-linked list to insert the new node into.
+ * \param[in] bytes A pointer to the bytes to be copied.
+ * \param[in] length The number of bytes to copy.
+ * 
+ * \remark The copy is suitably aligned for any type. Data obtained from a removal function is the start
+ *         of the allocation that holds the node: release it with `free`, or with a `destroy` method that ends
+ *         with `free`, as for data allocated with `malloc`.
+ * 
+ * \return 0 on success, or a non-zero value otherwise.
+ */
+extern int sList_insert_last_copy(const sList_t list, const void* bytes, size_t length);
+
+/* ================================ */
+
+/**
+ * \brief Inserts a copy of the given bytes at the beginning of a singly-linked list.
+ * 
+ * See \ref sList_insert_last_copy for how the copy is stored and released.
+ * 
+ * \param[in] list A singly-linked list to insert the new node into.
+ * \param[in] bytes A pointer to the bytes to be copied.
+ * \param[in] length The number of bytes to copy.
+ * 
+ * \return 0 on success, or a non-zero value otherwise.
+ */
+extern int sList_insert_first_copy(const sList_t list, const void* bytes, size_t length);
+
+/* ================================ */
+
 /**
  * \brief Removes the last node from a given singly-linked list and stores the data in `data`.
  * 
@@ -123,6 +242,12 @@ extern int sList_remove_first(const sList_t list, void** data);
 
 /* ================================ */
 
+/*
+ * With `SLL_INLINE` defined, the accessors below are defined as inline functions in `inline.h` instead,
+ * so calls to them do not go through the library.
+ */
+#ifndef SLL_INLINE
+
 /**
  * \brief Returns the size of a given singly-linked list.
  *
@@ -137,6 +262,32 @@ extern ssize_t sList_size(const sList_t list);
 
 /* ================================ */
 
+/**
+ * \brief Retrieves the data of the first node of a given singly-linked list without removing it.
+ *
+ * \param[in] list A singly-linked list.
+ * \param[out] data A pointer to store the data. It is set to `NULL` if the list is empty.
+ *
+ * \return 0 on success, a non-zero value otherwise, e.g. when the list is empty.
+ */
+extern int sList_peek_first(const sList_t list, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Retrieves the data of the last node of a given singly-linked list without removing it.
+ *
+ * \param[in] list A singly-linked list.
+ * \param[out] data A pointer to store the data. It is set to `NULL` if the list is empty.
+ *
+ * \return 0 on success, a non-zero value otherwise, e.g. when the list is empty.
+ */
+extern int sList_peek_last(const sList_t list, void** data);
+
+#endif /* SLL_INLINE */
+
+/* ================================ */
+
 /**
  * \brief Outputs the content of a given singly-linked list.
  *
@@ -157,6 +308,7 @@ extern int sList_print(const sList_t list, const char* delimiter);
  *
  * This function searches for a node with the given data in the specified singly-linked list.
  * It utilizes a `match` method provided in the \ref `sList_new` function to determine if a node matches the given data.
+ * If the list has a Bloom filter, see \ref sList_set_bloom, data the filter rules out is not searched for.
  *
  * \param[in] list A singly-linked list to be searched.
  * \param[in] data A pointer to the data to be searched for.
@@ -183,6 +335,22 @@ extern int sList_insert_after(const sList_t list, const sNode_t node, void* data
 
 /* ================================ */
 
+/**
+ * \brief Inserts a copy of the given bytes after the specified node in the given singly-linked list.
+ *
+ * See \ref sList_insert_last_copy for how the copy is stored and released.
+ *
+ * \param[in] list A pointer to the singly-linked list in which the data will be inserted.
+ * \param[in] node The node after which the data will be inserted.
+ * \param[in] bytes A pointer to the bytes to be copied.
+ * \param[in] length The number of bytes to copy.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sList_insert_after_copy(const sList_t list, const sNode_t node, const void* bytes, size_t length);
+
+/* ================================ */
+
 /**
  * \brief Inserts data before the specified node in the given singly-linked list.
  *
@@ -243,6 +411,55 @@ extern int sList_foreach(const sList_t list, int (*func)(void* data));
 
 /* ================================ */
 
+/**
+ * \brief Retrieves the data at a given position of a singly-linked list.
+ *
+ * The list remembers the node it last reached by position, and the walk starts from there when it can,
+ * so visiting positions in increasing order, as when paging through a list, takes constant time per step.
+ * Other positions cost a walk from the head, and the tail is reached directly.
+ *
+ * \param[in] list A singly-linked list.
+ * \param[in] index The position, 0 for the first element.
+ * \param[out] data A pointer to store the data.
+ *
+ * \return 0 on success, `E_NOTFOUND` if the position is past the end of the list, another non-zero value otherwise.
+ */
+extern int sList_at(const sList_t list, size_t index, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Inserts data at a given position of a singly-linked list.
+ *
+ * Reaching the position costs what \ref sList_at costs.
+ *
+ * \param[in] list A singly-linked list.
+ * \param[in] index The position the data will have, from 0 to the size of the list.
+ * \param[in] data A pointer to the data to be inserted.
+ *
+ * \return 0 on success, `E_NOTFOUND` if the position is past the end of the list, another non-zero value otherwise.
+ */
+extern int sList_insert_at(const sList_t list, size_t index, void* data);
+
+/* ================================ */
+
+/**
+ * \brief Removes the element at a given position of a singly-linked list and stores its data in `data`.
+ *
+ * Reaching the position costs what \ref sList_at costs.
+ *
+ * \param[in] list A singly-linked list.
+ * \param[in] index The position, 0 for the first element.
+ * \param[out] data A pointer to store the data.
+ *
+ * \return 0 on success, `E_NOTFOUND` if the position is past the end of the list, another non-zero value otherwise.
+ *
+ * \remark The caller is responsible for destroying the data to prevent memory leaks.
+ */
+extern int sList_remove_at(const sList_t list, size_t index, void** data);
+
+/* ================================ */
+
 /**
  * \brief Checks if a given node belongs to a given list.
  * 
@@ -277,6 +494,234 @@ extern int sList_next(const sList_t list, void** data);
 
 /* ================================ */
 
+/**
+ * \brief Sets the `hash` method of a singly-linked list.
+ *
+ * The list's Bloom filter, if any, is rebuilt with the new method, or removed along with the method.
+ *
+ * \param[in] list A singly-linked list.
+ * \param[in] hash A user-defined function that hashes data, `NULL` to remove it. For more information,
+ *                see the documentation for the \ref methods struct.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sList_set_hash(const sList_t list, size_t (*hash)(void* data));
+
+/* ================================ */
+
+/**
+ * \brief Gives a singly-linked list a counting Bloom filter, so \ref sList_find returns right away on most misses.
+ *
+ * The filter is kept up to date as elements are inserted and removed, using the list's `hash` method; data must
+ * not change its hash while it is in the list. A lookup the filter cannot rule out walks the list as usual.
+ * The filter takes about `1.44 * log2(1 / rate)` bytes per expected element, rounded up to a power of two,
+ * which can only lower the false-positive rate. Once the list outgrows `expected`, the rate rises.
+ *
+ * \param[in] list A singly-linked list with a `hash` method, see \ref sList_set_hash.
+ * \param[in] expected The number of elements the filter is sized for, 0 to remove the filter.
+ * \param[in] rate The rate of lookups of absent data that still walk the list, between 0 and 1, e.g. 0.01.
+ *
+ * \return 0 on success, `E_MISMET` if the list has no `hash` method, `E_INVAL` if the rate is not between 0 and 1,
+ *         `E_NOMEM` if the filter would be too large or cannot be allocated.
+ */
+extern int sList_set_bloom(const sList_t list, size_t expected, double rate);
+
+/* ================================ */
+
+/**
+ * \brief Removes from a singly-linked list every element that does not satisfy a predicate.
+ *
+ * The list is traversed once and its nodes are relinked in place. The data of removed elements is passed to the
+ * list's `destroy` method, or retired if the list has been published, see \ref sList_retire.
+ *
+ * \param[in] list A singly-linked list.
+ * \param[in] predicate A function returning non-zero for the data of elements to keep.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sList_filter(const sList_t list, int (*predicate)(void* data));
+
+/* ================================ */
+
+/**
+ * \brief Moves every element that does not satisfy a predicate from a singly-linked list to a new list.
+ *
+ * The list is traversed once and the nodes themselves are moved, keeping their order, so no node is allocated.
+ * The new list has the methods and the allocator of the original one. If the list has been published, the new
+ * list is published while still empty, so data it lets go of is retired until readers of the list's snapshots
+ * are done with it, see \ref sList_retire.
+ *
+ * \param[in] list A singly-linked list.
+ * \param[in] predicate A function returning non-zero for the data of elements to keep in `list`.
+ * \param[out] out A pointer to store the new list with the other elements.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sList_partition(const sList_t list, int (*predicate)(void* data), sList_t* out);
+
+/* ================================ */
+
+/**
+ * \brief Reverses the order of the elements of a singly-linked list in place.
+ *
+ * \param[in] list A singly-linked list.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sList_reverse(const sList_t list);
+
+/* ================================ */
+
+/**
+ * \brief Removes from a singly-linked list every element that matches an element before it.
+ *
+ * Elements are compared with the `match` method. If the list has a `hash` method, every element is looked up in
+ * a hash table of the elements kept so far, so the list is deduplicated in linear time; otherwise every element
+ * is compared with the ones kept before it. Removed data is disposed of as in \ref sList_filter.
+ *
+ * \param[in] list A singly-linked list.
+ *
+ * \return 0 on success, `E_MISMET` if the list has no `match` method, another non-zero value otherwise.
+ */
+extern int sList_unique(const sList_t list);
+
+/* ================================ */
+
+/**
+ * \brief Creates a copy of a singly-linked list with the same methods, allocator and elements, in the same order.
+ *
+ * The nodes of the copy are allocated in one block and linked in a single pass over the list; the block is released
+ * once its last node has been removed. Elements inserted with the `_copy` functions are copied byte for byte,
+ * the others by `copy`.
+ *
+ * \param[in] list A singly-linked list.
+ * \param[out] clone A pointer to store the copy.
+ * \param[in] copy A user-defined function returning a copy of data, or `NULL` if the copy fails. If it is `NULL`,
+ *               the copy shares the data with the list, which is only allowed when the list has no `destroy` method.
+ *
+ * \return 0 on success, `E_MISMET` if the data cannot be shared, another non-zero value otherwise;
+ *         on failure the copies already made are destroyed and `clone` is `NULL`.
+ */
+extern int sList_clone(const sList_t list, sList_t* clone, void* (*copy)(void* data));
+
+/* ================================ */
+
+/**
+ * \brief Creates a copy of a singly-linked list like \ref sList_clone, calling `copy` from several threads.
+ *
+ * The data is split into runs of consecutive elements, one per thread, and the calling thread takes the first one,
+ * so `copy` must be safe to call concurrently. This pays off when copying the data costs more than starting a thread.
+ *
+ * \param[in] list A singly-linked list.
+ * \param[out] clone A pointer to store the copy.
+ * \param[in] copy A user-defined function returning a copy of data, see \ref sList_clone.
+ * \param[in] threads The number of threads to copy with, 0 for one per online CPU.
+ *
+ * \return 0 on success, a non-zero value otherwise, see \ref sList_clone.
+ */
+extern int sList_clone_parallel(const sList_t list, sList_t* clone, void* (*copy)(void* data), size_t threads);
+
+/* ================================ */
+
+/**
+ * \brief Switches a singly-linked list to sync mode, so it can be shared by producer and consumer threads.
+ *
+ * In sync mode, \ref sList_insert_first, \ref sList_insert_last, their `_copy` variants, \ref sList_remove_first,
+ * \ref sList_remove_last and \ref sList_pop_wait take a lock inside the list and may be called from any thread.
+ * The other functions are not locked; the caller must keep them from running concurrently with anything else.
+ * Switching a list that is already in sync mode does nothing.
+ *
+ * \param[in] list A singly-linked list, not yet shared with other threads.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sList_set_sync(const sList_t list);
+
+/* ================================ */
+
+/**
+ * \brief Removes the first element of a list in sync mode, waiting for one to be inserted if the list is empty.
+ *
+ * The caller sleeps on a condition variable rather than polling \ref sList_size.
+ *
+ * \param[in] list A singly-linked list in sync mode.
+ * \param[out] data A pointer to store the data.
+ * \param[in] timeout The longest time to wait, in milliseconds: 0 does not wait, a negative value waits indefinitely.
+ *
+ * \return 0 on success, `E_TIMEOUT` if the list stayed empty, `E_MISMET` if the list is not in sync mode,
+ *         another non-zero value otherwise.
+ *
+ * \remark The caller is responsible for destroying the data to prevent memory leaks.
+ */
+extern int sList_pop_wait(const sList_t list, void** data, long timeout);
+
+/* ================================ */
+
+/**
+ * \brief Returns an eventfd that is readable exactly while a singly-linked list is not empty.
+ *
+ * The descriptor can be added to `epoll` or `poll` to learn when a consumer has work, without waiting in
+ * \ref sList_pop_wait. It is owned by the list and closed by \ref sList_destroy; callers must not read from it.
+ * The list is switched to sync mode if it is not already, and its emptiness is tracked through the functions
+ * that are locked in sync mode.
+ *
+ * \param[in] list A singly-linked list.
+ * \param[out] fd A pointer to store the descriptor.
+ *
+ * \return 0 on success, `E_MISMET` where eventfd is not available (it is Linux-specific), another non-zero value otherwise.
+ */
+extern int sList_eventfd(const sList_t list, int* fd);
+
+/* ================================ */
+
+/**
+ * \brief Sets the `payload` method of a singly-linked list, which reports the bytes held by each element's data.
+ *
+ * Elements already in the list are accounted for again with the new method.
+ *
+ * \param[in] list A singly-linked list.
+ * \param[in] payload A user-defined function returning the bytes held by data, `NULL` to count only the nodes.
+ *                   For more information, see the documentation for the \ref methods struct.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sList_set_payload(const sList_t list, size_t (*payload)(void* data));
+
+/* ================================ */
+
+/**
+ * \brief Caps the number of elements and the memory a singly-linked list may hold.
+ *
+ * Inserting into a list that has reached either limit fails with `E_FULL`. With `block` set, the list is
+ * switched to sync mode and \ref sList_insert_first, \ref sList_insert_last and their `_copy` variants wait
+ * instead until removals make room, so producers are held back by slow consumers; the other insertion functions
+ * still fail. An element larger than the whole byte limit is always refused.
+ *
+ * \param[in] list A singly-linked list.
+ * \param[in] max_size The most elements the list may hold, 0 for no limit.
+ * \param[in] max_bytes The most bytes the list may hold, as reported by \ref sList_bytes, 0 for no limit.
+ * \param[in] block Non-zero to wait for room rather than fail.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sList_set_limits(const sList_t list, size_t max_size, size_t max_bytes, int block);
+
+/* ================================ */
+
+/**
+ * \brief Returns the memory held by a singly-linked list's elements.
+ *
+ * The count covers the nodes, copies made by the `_copy` functions and the bytes reported by the `payload`
+ * method, see \ref sList_set_payload; it does not include the list's own bookkeeping.
+ *
+ * \param[in] list A singly-linked list.
+ *
+ * \return The number of bytes on success, a negative value otherwise.
+ */
+extern ssize_t sList_bytes(const sList_t list);
+
+/* ================================ */
+
 /**
  * \brief Prints a meaningful error message based on the returned value from `sList_` family of functions.
  * 
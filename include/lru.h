@@ -0,0 +1,119 @@
+#ifndef lru_h
+#define lru_h
+
+/* ================================================================ */
+
+/**
+ * \brief Creates a new least-recently-used cache.
+ *
+ * The cache keeps its entries in order of use and indexes them by hash, so lookups, insertions,
+ * moves to the front and evictions take constant time. A key is anything `hash` and `match` understand:
+ * `match(data, key)` must return 0 exactly when `data` is the element identified by `key`, and matching data
+ * and keys must hash equally. Data itself is used as the key when it is put into the cache.
+ *
+ * \param[out] lru A pointer to store the new cache.
+ * \param[in] capacity The maximum number of entries, 0 for an unbounded cache.
+ * \param[in] destroy A user-defined function to free evicted or replaced data, `NULL` if the cache does not own its data.
+ *                For more information, see the documentation for the \ref methods struct.
+ * \param[in] hash A user-defined function that hashes data and keys.
+ * \param[in] match A user-defined function to compare data with a key. For more information, see the documentation
+ *                for the \ref methods struct.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sLRU_new(sLRU_t* lru, size_t capacity, void (*destroy)(void* data), size_t (*hash)(void* data), int (*match)(void* data_1, void* data_2));
+
+/* ================================ */
+
+/**
+ * \brief Destroys a cache, calling `destroy` on the data of every entry.
+ *
+ * \param[in] lru A pointer to the cache to be destroyed. Upon return the cache is `NULL`.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sLRU_destroy(sLRU_t* lru);
+
+/* ================================ */
+
+/**
+ * \brief Puts data into a cache as its most recently used entry.
+ *
+ * If an entry matching the data exists, its data is replaced (and destroyed). If the cache exceeds its capacity,
+ * the least recently used entry is evicted and its data destroyed.
+ *
+ * \param[in] lru A cache.
+ * \param[in] data The data to put.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sLRU_put(const sLRU_t lru, void* data);
+
+/* ================================ */
+
+/**
+ * \brief Retrieves the data matching a key and marks it as the most recently used entry.
+ *
+ * \param[in] lru A cache.
+ * \param[in] key The key to look up.
+ * \param[out] data A pointer to store the data.
+ *
+ * \return 0 on success, `E_NOTFOUND` if no entry matches, another non-zero value otherwise.
+ */
+extern int sLRU_get(const sLRU_t lru, void* key, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Marks the entry matching a key as the most recently used one.
+ *
+ * \param[in] lru A cache.
+ * \param[in] key The key to look up.
+ *
+ * \return 0 on success, `E_NOTFOUND` if no entry matches, another non-zero value otherwise.
+ */
+extern int sLRU_touch(const sLRU_t lru, void* key);
+
+/* ================================ */
+
+/**
+ * \brief Removes the entry matching a key and stores its data in `data`.
+ *
+ * \param[in] lru A cache.
+ * \param[in] key The key to look up.
+ * \param[out] data A pointer to store the data.
+ *
+ * \return 0 on success, `E_NOTFOUND` if no entry matches, another non-zero value otherwise.
+ *
+ * \remark The caller is responsible for destroying the data to prevent memory leaks.
+ */
+extern int sLRU_remove(const sLRU_t lru, void* key, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Removes the least recently used entry and stores its data in `data`.
+ *
+ * \param[in] lru A cache.
+ * \param[out] data A pointer to store the data.
+ *
+ * \return 0 on success, `E_NOTFOUND` if the cache is empty, another non-zero value otherwise.
+ *
+ * \remark The caller is responsible for destroying the data to prevent memory leaks.
+ */
+extern int sLRU_evict(const sLRU_t lru, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Returns the number of entries in a cache.
+ *
+ * \param[in] lru A cache.
+ *
+ * \return The size of the cache, or -1 otherwise.
+ */
+extern ssize_t sLRU_size(const sLRU_t lru);
+
+/* ================================================================ */
+
+#endif /* lru_h */
@@ -10,6 +10,7 @@ extern "C" {
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <sys/types.h>
 #include <errno.h>
 #include <string.h>
@@ -17,6 +18,18 @@ extern "C" {
 
 #include "types.h"
 #include "list.h"
+#include "snapshot.h"
+#include "lru.h"
+#include "compact.h"
+#include "work.h"
+#include "heap.h"
+#include "keyed.h"
+#include "ttl.h"
+#include "view.h"
+
+#ifdef SLL_INLINE
+    #include "inline.h"
+#endif
 
 /* ================================================================ */
 
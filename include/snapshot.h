@@ -0,0 +1,101 @@
+#ifndef snapshot_h
+#define snapshot_h
+
+/* ================================================================ */
+
+/**
+ * \brief Publishes an immutable snapshot of a given singly-linked list for readers.
+ *
+ * This function copies the data pointers of the list into a new snapshot and makes it the one
+ * returned by \ref sList_snapshot. Readers that already hold an older snapshot keep it until they release it.
+ * Publishing is a writer operation: it must not run concurrently with other modifications of the list,
+ * and it traverses the whole list, so writers usually publish after a batch of changes rather than after each one.
+ *
+ * \param[in] list A singly-linked list to publish.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sList_publish(const sList_t list);
+
+/* ================================ */
+
+/**
+ * \brief Destroys data removed from a given singly-linked list once no snapshot refers to it.
+ *
+ * Data removed from a published list may still be read through snapshots. Instead of destroying it right away,
+ * a writer hands it to this function, which calls the list's `destroy` method on it after every snapshot
+ * that could contain it has been released. Data still in the list when it is destroyed is retired the same way.
+ *
+ * \param[in] list The singly-linked list the data has been removed from.
+ * \param[in] data Data removed from the list.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sList_retire(const sList_t list, void* data);
+
+/* ================================ */
+
+/**
+ * \brief Acquires the snapshot most recently published for a given singly-linked list.
+ *
+ * This function can be called by readers while writers modify the list. It neither waits for
+ * writers nor makes them wait beyond a short critical section. The snapshot remains valid and unchanged until
+ * it is released with \ref sSnapshot_release.
+ *
+ * \param[in] list A singly-linked list.
+ * \param[out] snapshot A pointer to store the snapshot.
+ *
+ * \return 0 on success, a non-zero value otherwise, e.g. when no snapshot has been published yet.
+ */
+extern int sList_snapshot(const sList_t list, sSnapshot_t* snapshot);
+
+/* ================================ */
+
+/**
+ * \brief Releases a snapshot acquired with \ref sList_snapshot.
+ *
+ * \param[in] snapshot A pointer to the snapshot to release. Upon return the snapshot is `NULL`.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sSnapshot_release(sSnapshot_t* snapshot);
+
+/* ================================ */
+
+/**
+ * \brief Returns the number of elements in a given snapshot.
+ *
+ * \param[in] snapshot A snapshot.
+ *
+ * \return The size of the snapshot, or -1 otherwise.
+ */
+extern ssize_t sSnapshot_size(const sSnapshot_t snapshot);
+
+/* ================================ */
+
+/**
+ * \brief Retrieves the data at a given position of a snapshot.
+ *
+ * \param[in] snapshot A snapshot.
+ * \param[in] index The position of the element, starting at 0.
+ * \param[out] data A pointer to store the data.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sSnapshot_at(const sSnapshot_t snapshot, size_t index, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Applies a specified function to every element of a given snapshot.
+ *
+ * \param[in] snapshot A snapshot to be traversed.
+ * \param[in] func A function pointer to the function to be applied to each element's data.
+ *
+ * \return Upon successful execution, the function returns the sum of the values returned by `func`; a non-zero value otherwise.
+ */
+extern int sSnapshot_foreach(const sSnapshot_t snapshot, int (*func)(void* data));
+
+/* ================================================================ */
+
+#endif /* snapshot_h */
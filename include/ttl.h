@@ -0,0 +1,104 @@
+#ifndef ttl_h
+#define ttl_h
+
+/* ================================================================ */
+
+/**
+ * \brief Creates a new expiry container.
+ *
+ * The container keeps data until a deadline and hands it to `expire` once the deadline has passed. Deadlines are
+ * sorted into a hierarchical timer wheel, so inserting and refreshing take constant time and \ref sTTL_expire
+ * touches only the elements that expire, plus the few that move closer to the lowest level of the wheel.
+ * Time is measured in ticks of the caller's choosing, e.g. milliseconds of `CLOCK_MONOTONIC`; it must not go backwards.
+ *
+ * \param[out] ttl A pointer to store the new container.
+ * \param[in] now The current time.
+ * \param[in] destroy A user-defined function to free the data still in the container when it is destroyed.
+ *                For more information, see the documentation for the \ref methods struct.
+ * \param[in] expire A user-defined function called on the data of every expired element, `NULL` to call `destroy` instead.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sTTL_new(sTTL_t* ttl, uint64_t now, void (*destroy)(void* data), void (*expire)(void* data));
+
+/* ================================ */
+
+/**
+ * \brief Destroys an expiry container, calling `destroy` on the data of every element, expired or not.
+ *
+ * \param[in] ttl A pointer to the container to be destroyed. Upon return the container is `NULL`.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sTTL_destroy(sTTL_t* ttl);
+
+/* ================================ */
+
+/**
+ * \brief Inserts data that expires at a given time.
+ *
+ * \param[in] ttl An expiry container.
+ * \param[in] data A pointer to the data.
+ * \param[in] deadline The time at which the data expires; a deadline that has already passed expires on the next tick.
+ * \param[out] timer A pointer to store a handle to the element, for \ref sTTL_refresh and \ref sTTL_cancel; may be `NULL`.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sTTL_insert(const sTTL_t ttl, void* data, uint64_t deadline, sTimer_t* timer);
+
+/* ================================ */
+
+/**
+ * \brief Moves the deadline of an element, e.g. when a session is used again.
+ *
+ * \param[in] ttl An expiry container.
+ * \param[in] timer A handle to an element that has not expired.
+ * \param[in] deadline The new deadline.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+extern int sTTL_refresh(const sTTL_t ttl, sTimer_t timer, uint64_t deadline);
+
+/* ================================ */
+
+/**
+ * \brief Removes an element before it expires and stores its data in `data`.
+ *
+ * \param[in] ttl An expiry container.
+ * \param[in] timer A handle to an element that has not expired. The handle is invalid afterwards.
+ * \param[out] data A pointer to store the data.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ *
+ * \remark The caller is responsible for destroying the data to prevent memory leaks.
+ */
+extern int sTTL_cancel(const sTTL_t ttl, sTimer_t timer, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Advances the time of an expiry container, expiring every element whose deadline is not after `now`.
+ *
+ * Elements are expired tick by tick, earlier deadlines first. The `expire` function must not call other functions on the container.
+ *
+ * \param[in] ttl An expiry container.
+ * \param[in] now The current time.
+ *
+ * \return The number of expired elements, or -1 otherwise.
+ */
+extern ssize_t sTTL_expire(const sTTL_t ttl, uint64_t now);
+
+/* ================================ */
+
+/**
+ * \brief Returns the number of elements in an expiry container.
+ *
+ * \param[in] ttl An expiry container.
+ *
+ * \return The size of the container, or -1 otherwise.
+ */
+extern ssize_t sTTL_size(const sTTL_t ttl);
+
+/* ================================================================ */
+
+#endif /* ttl_h */
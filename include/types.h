@@ -9,6 +9,10 @@ enum linked_list_error {
     E_NOMEM = 2,       /* Out of memory */
     E_MISMET = 3,      /* Missing list method */
     E_MATCH = 4,       /* A node doesn't belong to the list */
+    E_NOTFOUND = 5,    /* No element matches the key */
+    E_TIMEOUT = 6,     /* Nothing arrived before the timeout */
+    E_FULL = 7,        /* The list has reached its limits */
+    E_INVAL = 8,       /* An argument is outside its valid range */
 };
 
 /**
@@ -25,6 +29,114 @@ typedef struct singly_linked_list* sList_t;
 
 /* ================================ */
 
+/**
+ * \brief A pointer to an incomplete data type, an immutable view of a list published by \ref sList_publish.
+ */
+typedef struct snapshot* sSnapshot_t;
+
+/* ================================ */
+
+/**
+ * \brief A pointer to an incomplete data type, a least-recently-used cache.
+ */
+typedef struct lru* sLRU_t;
+
+/* ================================ */
+
+/**
+ * \brief A pointer to an incomplete data type, a singly-linked list whose nodes live in a pool and are linked by 32-bit indices.
+ */
+typedef struct compact_list* sCList_t;
+
+/**
+ * \brief A handle to a node of an \ref sCList_t: the id of the list's pool, the generation of the node's slot and its index.
+ *
+ * Pool ids are never reused and a slot is retired before its generation wraps, so a handle cannot be mistaken
+ * for one to a node of another list or to a node inserted after its own was removed.
+ */
+typedef struct {
+    uint64_t pool;          /**< The id of the list's pool */
+    uint32_t index;         /**< The node's slot */
+    uint32_t generation;    /**< The generation of the slot when the handle was made */
+} sCNode_t;
+
+/* ================================ */
+
+/**
+ * \brief A pointer to an incomplete data type, a work container sharded into one deque per worker.
+ */
+typedef struct work* sWork_t;
+
+/* ================================ */
+
+/**
+ * \brief A pointer to an incomplete data type, a priority queue whose elements are referred to by \ref sHNode_t handles.
+ */
+typedef struct heap* sHeap_t;
+
+/**
+ * \brief A handle to an element of an \ref sHeap_t: the element and the generation of its slot.
+ *
+ * Elements are recycled once removed; the generation tells a handle to a removed element apart from one
+ * to the element that took its place.
+ */
+typedef struct {
+    sNode_t node;           /**< The element */
+    size_t generation;      /**< The generation of the element's slot when the handle was made */
+} sHNode_t;
+
+/* ================================ */
+
+/**
+ * \brief A pointer to an incomplete data type, a list of data stored with integer keys in chunks that can be searched with SIMD instructions.
+ */
+typedef struct keyed_list* sKList_t;
+
+/* ================================ */
+
+/**
+ * \brief A pointer to an incomplete data type, a container that expires its elements at given times.
+ */
+typedef struct ttl* sTTL_t;
+
+/**
+ * \brief A pointer to an incomplete data type, an element of an \ref sTTL_t.
+ */
+typedef struct timer* sTimer_t;
+
+/* ================================ */
+
+/**
+ * \brief A range of consecutive elements of a list, see \ref sList_view. A view does not own the elements and
+ * is not allocated: it is a plain value, which can be copied and handed to another thread. Its fields are not part of the interface.
+ */
+typedef struct view {
+
+    sList_t list;
+    sNode_t first;      /**< The first node of the range, `NULL` if the range is empty */
+    size_t length;      /**< Number of elements in the range */
+
+    sNode_t cursor;     /**< The node \ref sView_next returns next */
+    size_t position;    /**< Number of elements \ref sView_next has returned */
+} sView_t;
+
+/* ================================ */
+
+/**
+ * \brief Memory allocation functions a list obtains its nodes and its own bookkeeping from.
+ */
+typedef struct allocator {
+
+    void* (*alloc)(void* context, size_t size);     /**< Returns at least `size` bytes suitably aligned for any type, or `NULL` */
+    void (*free)(void* context, void* pointer);     /**< Releases memory returned by `alloc`; `NULL` if memory is released wholesale */
+
+    void* context;                                  /**< Passed to both functions, e.g. an arena */
+
+    int zeroed;                                     /**< Non-zero if `alloc` returns zero-filled memory */
+} sAllocator_t;
+
+/* ================================ */
+
 /* Singly-linked list methods */
 typedef struct methods* Methods;
 
@@ -0,0 +1,112 @@
+#ifndef view_h
+#define view_h
+
+/* ================================================================ */
+
+/**
+ * \brief Sets up a view of the elements of a singly-linked list at given positions.
+ *
+ * A view covers a range of consecutive elements, so a window of a list can be traversed, searched and split
+ * without copying it into another list. The list's nodes are not changed. The view stays valid as long as none
+ * of the elements in its range is removed; inserting elements inside the range makes the view skip them or stop early.
+ * Setting up a view moves the list's finger, see \ref sList_at, so it is done by the thread that modifies the list;
+ * the views themselves can then be used by any thread while the list is not modified.
+ *
+ * \param[in] list A singly-linked list.
+ * \param[in] index The position of the first element of the view, starting at 0.
+ * \param[in] length The number of elements in the view; a range running past the end of the list ends at its last element.
+ * \param[out] view A pointer to the view to set up.
+ *
+ * \return 0 on success, `E_NOTFOUND` if the position is past the end of the list, another non-zero value otherwise.
+ */
+extern int sList_view(const sList_t list, size_t index, size_t length, sView_t* view);
+
+/* ================================ */
+
+/**
+ * \brief Sets up a view of the elements of a singly-linked list between two of its nodes, both included.
+ *
+ * The range is walked once to count its elements.
+ *
+ * \param[in] list A singly-linked list.
+ * \param[in] first The first node of the view, e.g. one found with \ref sList_find.
+ * \param[in] last The last node of the view, `NULL` for the tail of the list.
+ * \param[out] view A pointer to the view to set up.
+ *
+ * \return 0 on success, `E_MATCH` if a node does not belong to the list or `last` does not follow `first`,
+ *         another non-zero value otherwise.
+ */
+extern int sList_view_range(const sList_t list, const sNode_t first, const sNode_t last, sView_t* view);
+
+/* ================================ */
+
+/**
+ * \brief Returns the number of elements in a view.
+ *
+ * \param[in] view A view.
+ *
+ * \return The size of the view, or a negative value otherwise.
+ */
+extern ssize_t sView_size(const sView_t* view);
+
+/* ================================ */
+
+/**
+ * \brief Calls a function on the data of every element of a view, in order.
+ *
+ * \param[in] view A view.
+ * \param[in] func A function to call on each element's data.
+ *
+ * \return The sum of the values returned by `func`.
+ */
+extern int sView_foreach(const sView_t* view, int (*func)(void* data));
+
+/* ================================ */
+
+/**
+ * \brief Finds the first element of a view whose data matches given data, using the list's `match` method.
+ *
+ * \param[in] view A view.
+ * \param[in] data The data to look for.
+ * \param[out] node A pointer to store the node of the element.
+ *
+ * \return 0 on success, `E_NOTFOUND` if no element matches, `E_MISMET` if the list has no `match` method,
+ *         another non-zero value otherwise.
+ */
+extern int sView_find(const sView_t* view, void* data, sNode_t* node);
+
+/* ================================ */
+
+/**
+ * \brief Returns the data of the next element of a view.
+ *
+ * Unlike \ref sList_next, the position is kept in the view itself, so any number of views can be iterated over
+ * at the same time, each by its own thread.
+ *
+ * \param[in] view A view.
+ * \param[out] data A pointer to store the data.
+ *
+ * \return 0 on success, `E_NOTFOUND` once every element has been returned; the next call starts over.
+ */
+extern int sView_next(sView_t* view, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Splits a view into consecutive views of nearly equal size, e.g. one per worker thread.
+ *
+ * The views are disjoint and together cover the original one; the first ones get one element more when the
+ * size does not divide evenly, and the last ones are empty if there are more parts than elements.
+ * The view is walked once to find where the parts start.
+ *
+ * \param[in] view A view.
+ * \param[in] parts The number of parts.
+ * \param[out] views An array of `parts` views to set up.
+ *
+ * \return 0 on success, `E_INVAL` if there are no parts, another non-zero value otherwise.
+ */
+extern int sView_split(const sView_t* view, size_t parts, sView_t* views);
+
+/* ================================================================ */
+
+#endif /* view_h */
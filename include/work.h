@@ -0,0 +1,94 @@
+#ifndef work_h
+#define work_h
+
+/* ================================================================ */
+
+/**
+ * \brief Creates a new work container for a pool of worker threads.
+ *
+ * Instead of one queue every worker contends on, the container holds a deque per worker. A worker pushes and
+ * pops items at the bottom of its own deque, which only synchronizes with thieves when the deque is nearly empty,
+ * and a worker that runs out of work steals from the top of another worker's deque (Chase–Lev). Workers are
+ * identified by their index, from 0 to `workers - 1`; every index must be used by a single thread at a time.
+ * A deque grows as needed and never shrinks before the container is destroyed, so its memory follows the most items
+ * it ever held: at most twice what its largest array takes, as thieves may still read the smaller arrays it replaced.
+ *
+ * \param[out] work A pointer to store the new container.
+ * \param[in] workers The number of workers, and of deques.
+ * \param[in] destroy A user-defined function to free the items still in the container when it is destroyed.
+ *                For more information, see the documentation for the \ref methods struct.
+ *
+ * \return 0 on success, `E_INVAL` if there are no workers, another non-zero value otherwise.
+ */
+extern int sWork_new(sWork_t* work, size_t workers, void (*destroy)(void* data));
+
+/* ================================ */
+
+/**
+ * \brief Destroys a work container, calling `destroy` on every item left in it.
+ *
+ * \param[in] work A pointer to the container to be destroyed. Upon return the container is `NULL`.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ *
+ * \remark No worker may use the container while it is being destroyed.
+ */
+extern int sWork_destroy(sWork_t* work);
+
+/* ================================ */
+
+/**
+ * \brief Pushes an item onto the deque of a given worker.
+ *
+ * \param[in] work A work container.
+ * \param[in] worker The index of the calling worker; only the owner of a deque pushes onto it.
+ * \param[in] data The item.
+ *
+ * \return 0 on success, `E_INVAL` if there is no such worker, another non-zero value otherwise.
+ */
+extern int sWork_push(const sWork_t work, size_t worker, void* data);
+
+/* ================================ */
+
+/**
+ * \brief Pops the item most recently pushed by a given worker.
+ *
+ * \param[in] work A work container.
+ * \param[in] worker The index of the calling worker; only the owner of a deque pops from it.
+ * \param[out] data A pointer to store the item.
+ *
+ * \return 0 on success, `E_NOTFOUND` if the worker's deque is empty, `E_INVAL` if there is no such worker,
+ *         another non-zero value otherwise.
+ */
+extern int sWork_pop(const sWork_t work, size_t worker, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Steals the oldest item of another worker's deque.
+ *
+ * Victims are tried in turn, starting with the worker after the caller, until an item is taken or every
+ * deque has been seen empty. Any thread may steal, including threads that are not workers.
+ *
+ * \param[in] work A work container.
+ * \param[in] worker The index of the calling worker, whose own deque is skipped.
+ * \param[out] data A pointer to store the item.
+ *
+ * \return 0 on success, `E_NOTFOUND` if there was nothing to steal, another non-zero value otherwise.
+ */
+extern int sWork_steal(const sWork_t work, size_t worker, void** data);
+
+/* ================================ */
+
+/**
+ * \brief Returns the number of items in a work container.
+ *
+ * \param[in] work A work container.
+ *
+ * \return The number of items, or -1 otherwise. While workers run, the count is only a snapshot.
+ */
+extern ssize_t sWork_size(const sWork_t work);
+
+/* ================================================================ */
+
+#endif /* work_h */
@@ -0,0 +1,487 @@
+#include "../include/sll.h"
+
+#include <stdatomic.h>
+
+/* ================================================================ */
+
+/* The index that terminates a chain of nodes */
+#define NIL UINT32_MAX
+
+/* Number of slots a pool starts with when no capacity is given */
+#define POOL_SLOTS 64
+
+/**
+ * A node of a compact list. It takes 16 bytes in the pool's array, against the 24 bytes (32 with the allocator's
+ * header) a node of \ref sList_t takes, and it carries no pointer to its list: a node belongs to the list
+ * whose pool holds it, which a handle identifies by the pool id.
+ */
+struct compact_node {
+
+    void* data;             /**< Node's data, `NULL` if the slot is free */
+
+    uint32_t next;          /**< The index of the next node in the list, or of the next free slot */
+    uint32_t generation;    /**< Incremented every time the slot is freed, so handles to the old node go stale */
+};
+
+/**
+ * A singly-linked list whose nodes live in a single array owned by the list.
+ */
+struct compact_list {
+
+    struct compact_node* nodes;     /**< The pool */
+    uint32_t capacity;              /**< Number of slots in the pool */
+    uint32_t unused;                /**< Slots at and after this index have never been used */
+    uint32_t free;                  /**< The first free slot, `NIL` if there are none */
+
+    uint32_t head;                  /**< The first node of the list */
+    uint32_t tail;                  /**< The last node of the list */
+
+    ssize_t size;                   /**< Number of elements in the list */
+
+    uint64_t id;                    /**< Tells nodes of this list apart from nodes of other lists */
+
+    void (*destroy)(void* data);                /**< See the \ref methods struct */
+    int (*match)(void* data_1, void* data_2);   /**< See the \ref methods struct */
+};
+
+/* Source of pool ids; 64 bits never wrap, so no two lists share an id */
+static _Atomic uint64_t pools = 0;
+
+/* ================================ */
+
+/**
+ * \brief Packs a handle to the node in a given slot.
+ */
+static sCNode_t Handle(const sCList_t list, uint32_t index) {
+
+    sCNode_t node = {list->id, index, list->nodes[index].generation};
+
+    return node;
+}
+
+/* ================================ */
+
+/**
+ * \brief Resolves a handle to the index of a node of a given list.
+ *
+ * \return The index, or `NIL` if the handle refers to a node of another list or to a node that has been removed.
+ */
+static uint32_t Handle_index(const sCList_t list, sCNode_t node) {
+
+    uint32_t index = node.index;
+
+    if ((node.pool != list->id) || (index >= list->unused)) {
+        return NIL;
+    }
+
+    if ((list->nodes[index].data == NULL) || (list->nodes[index].generation != node.generation)) {
+        return NIL;
+    }
+
+    return index;
+}
+
+/* ================================ */
+
+/**
+ * \brief Takes a slot from the pool, growing the pool if it is full.
+ *
+ * \return 0 on success, a non-zero value otherwise.
+ */
+static int Slot_new(const sCList_t list, void* data, uint32_t* index) {
+
+    struct compact_node* nodes = NULL;
+
+    if (data == NULL) {
+        return E_NULL_V;
+    }
+
+    if (list->free != NIL) {
+        *index = list->free;
+        list->free = list->nodes[*index].next;
+    }
+    else {
+
+        if (list->unused == list->capacity) {
+
+            /* NIL is never a valid index */
+            uint32_t capacity = (list->capacity < NIL / 2) ? list->capacity * 2 : NIL - 1;
+
+            if ((capacity == list->capacity) || ((nodes = realloc(list->nodes, capacity * sizeof(struct compact_node))) == NULL)) {
+                return E_NOMEM;
+            }
+
+            list->nodes = nodes;
+            list->capacity = capacity;
+        }
+
+        *index = list->unused++;
+
+        list->nodes[*index].generation = 0;
+    }
+
+    list->nodes[*index].data = data;
+    list->nodes[*index].next = NIL;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+/**
+ * \brief Returns a slot to the pool, storing the data of its node in `data`.
+ */
+static void Slot_free(const sCList_t list, uint32_t index, void** data) {
+
+    *data = list->nodes[index].data;
+
+    list->nodes[index].data = NULL;
+
+    /* A slot whose generation wraps is retired, as handles to its first node would become valid again */
+    if (++list->nodes[index].generation != 0) {
+        list->nodes[index].next = list->free;
+        list->free = index;
+    }
+
+    list->size--;
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * \brief Finds the node that precedes a given node.
+ *
+ * \return The index of the predecessor, or `NIL` if the node is the head.
+ */
+static uint32_t Slot_previous(const sCList_t list, uint32_t index) {
+
+    uint32_t previous = NIL;
+    uint32_t i = list->head;
+
+    for (; (i != NIL) && (i != index); i = list->nodes[i].next) {
+        previous = i;
+    }
+
+    return previous;
+}
+
+/* ================================================================ */
+
+int sCList_new(sCList_t* list, size_t capacity, void (*destroy)(void* data), int (*match)(void* data_1, void* data_2)) {
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    if ((capacity == 0) || (capacity >= NIL)) {
+        capacity = POOL_SLOTS;
+    }
+
+    if ((*list = calloc(1, sizeof(struct compact_list))) == NULL) {
+        return E_NOMEM;
+    }
+
+    if (((*list)->nodes = malloc(capacity * sizeof(struct compact_node))) == NULL) {
+        free(*list);
+
+        *list = NULL;
+
+        return E_NOMEM;
+    }
+
+    (*list)->capacity = (uint32_t) capacity;
+    (*list)->free = (*list)->head = (*list)->tail = NIL;
+
+    (*list)->id = atomic_fetch_add(&pools, 1);
+
+    (*list)->destroy = destroy;
+    (*list)->match = match;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sCList_destroy(sCList_t* list) {
+
+    if ((list == NULL) || (*list == NULL)) {
+        return E_NULL_V;
+    }
+
+    if ((*list)->destroy != NULL) {
+
+        for (uint32_t i = (*list)->head; i != NIL; i = (*list)->nodes[i].next) {
+            (*list)->destroy((*list)->nodes[i].data);
+        }
+    }
+
+    free((*list)->nodes);
+    free(*list);
+
+    *list = NULL;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sCList_insert_last(const sCList_t list, void* data) {
+
+    int result = E_OK;
+
+    uint32_t index = NIL;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    if ((result = Slot_new(list, data, &index)) != E_OK) {
+        return result;
+    }
+
+    if (list->size == 0) {
+        list->head = list->tail = index;
+    }
+    else {
+        list->nodes[list->tail].next = index;
+        list->tail = index;
+    }
+
+    list->size++;
+
+    return result;
+}
+
+/* ================================ */
+
+int sCList_insert_first(const sCList_t list, void* data) {
+
+    int result = E_OK;
+
+    uint32_t index = NIL;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    if ((result = Slot_new(list, data, &index)) != E_OK) {
+        return result;
+    }
+
+    if (list->size == 0) {
+        list->head = list->tail = index;
+    }
+    else {
+        list->nodes[index].next = list->head;
+        list->head = index;
+    }
+
+    list->size++;
+
+    return result;
+}
+
+/* ================================ */
+
+int sCList_insert_after(const sCList_t list, sCNode_t node, void* data) {
+
+    int result = E_OK;
+
+    uint32_t after = NIL;
+    uint32_t index = NIL;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    if ((after = Handle_index(list, node)) == NIL) {
+        return E_MATCH;
+    }
+
+    if (after == list->tail) {
+        return sCList_insert_last(list, data);
+    }
+
+    if ((result = Slot_new(list, data, &index)) != E_OK) {
+        return result;
+    }
+
+    list->nodes[index].next = list->nodes[after].next;
+    list->nodes[after].next = index;
+
+    list->size++;
+
+    return result;
+}
+
+/* ================================ */
+
+int sCList_remove_first(const sCList_t list, void** data) {
+
+    uint32_t index = NIL;
+
+    if ((list == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if (list->size == 0) {
+        return E_NOTFOUND;
+    }
+
+    index = list->head;
+
+    if ((list->head = list->nodes[index].next) == NIL) {
+        list->tail = NIL;
+    }
+
+    Slot_free(list, index, data);
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sCList_remove_last(const sCList_t list, void** data) {
+
+    uint32_t index = NIL;
+    uint32_t previous = NIL;
+
+    if ((list == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if (list->size == 0) {
+        return E_NOTFOUND;
+    }
+
+    index = list->tail;
+
+    if ((previous = Slot_previous(list, index)) == NIL) {
+        list->head = list->tail = NIL;
+    }
+    else {
+        list->nodes[previous].next = NIL;
+        list->tail = previous;
+    }
+
+    Slot_free(list, index, data);
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sCList_delete_Node(const sCList_t list, sCNode_t node, void** data) {
+
+    uint32_t index = NIL;
+    uint32_t previous = NIL;
+
+    if ((list == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if ((index = Handle_index(list, node)) == NIL) {
+        return E_MATCH;
+    }
+
+    if ((previous = Slot_previous(list, index)) == NIL) {
+        list->head = list->nodes[index].next;
+    }
+    else {
+        list->nodes[previous].next = list->nodes[index].next;
+    }
+
+    if (list->tail == index) {
+        list->tail = previous;
+    }
+
+    Slot_free(list, index, data);
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sCList_find(const sCList_t list, void* data, sCNode_t* node) {
+
+    if ((list == NULL) || (data == NULL) || (node == NULL)) {
+        return E_NULL_V;
+    }
+
+    if (list->match == NULL) {
+        return E_MISMET;
+    }
+
+    for (uint32_t i = list->head; i != NIL; i = list->nodes[i].next) {
+
+        if (list->match(list->nodes[i].data, data) == 0) {
+            *node = Handle(list, i);
+
+            return E_OK;
+        }
+    }
+
+    return E_NOTFOUND;
+}
+
+/* ================================ */
+
+int sCList_get(const sCList_t list, sCNode_t node, void** data) {
+
+    uint32_t index = NIL;
+
+    if ((list == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if ((index = Handle_index(list, node)) == NIL) {
+        return E_MATCH;
+    }
+
+    *data = list->nodes[index].data;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sCList_foreach(const sCList_t list, int (*func)(void* data)) {
+
+    int result = E_OK;
+
+    if ((list == NULL) || (func == NULL)) {
+        return E_NULL_V;
+    }
+
+    for (uint32_t i = list->head; i != NIL; i = list->nodes[i].next) {
+        result += func(list->nodes[i].data);
+    }
+
+    return result;
+}
+
+/* ================================ */
+
+ssize_t sCList_size(const sCList_t list) {
+
+    if (list == NULL) {
+        return -E_NULL_V;
+    }
+
+    return list->size;
+}
+
+/* ================================ */
+
+int sCNode_belongs(sCNode_t node, const sCList_t list) {
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    return Handle_index(list, node) == NIL;
+}
+
+/* ================================================================ */
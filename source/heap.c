@@ -0,0 +1,578 @@
+#include "../include/sll.h"
+#include "../include/internal.h"
+
+/* ================================================================ */
+
+/* Number of elements a slab holds when the queue runs out of free ones */
+#define SLAB_NODES 64
+
+/**
+ * An element of a pairing heap. It starts with a list node, which \ref sHNode_t handles refer to:
+ * `next` links the element to its next sibling and `data` holds its data; `list` is not used.
+ */
+struct heap_node {
+
+    struct singly_linked_list_node node;
+
+    struct heap_node* child;    /**< The first child */
+    struct heap_node* prev;     /**< The previous sibling, the parent for a first child, `NULL` for the root */
+
+    size_t generation;          /**< Incremented every time the element is removed, so handles to it go stale */
+};
+
+/**
+ * A block of elements. Elements are never freed on their own: removed ones go to the queue's free list.
+ */
+struct slab {
+
+    struct slab* next;
+
+    struct heap_node nodes[];
+};
+
+/**
+ * A priority queue: a pairing heap over elements taken from slabs.
+ */
+struct heap {
+
+    struct heap_node* root;     /**< The first element */
+    ssize_t size;               /**< Number of elements in the queue */
+
+    struct heap_node* free;     /**< Unused elements, linked through `node.next`; their data is `NULL` */
+    struct heap_node* free_last;    /**< The last unused element, meaningful while `free` is not `NULL` */
+
+    struct slab* slabs;
+    struct slab** last;         /**< The link a new slab is stored in */
+
+    void (*destroy)(void* data);                    /**< See the \ref methods struct */
+    int (*compare)(void* data_1, void* data_2);     /**< Orders the elements */
+};
+
+/* ================================ */
+
+/**
+ * \brief Returns the sibling of an element.
+ */
+static struct heap_node* Node_sibling(const struct heap_node* node) {
+    return (struct heap_node*) node->node.next;
+}
+
+/* ================================ */
+
+/**
+ * \brief Allocates a slab of `count` elements and adds it to a queue.
+ *
+ * \return The slab's elements, or `NULL` if there is no memory for them.
+ */
+static struct heap_node* Slab_new(const sHeap_t heap, size_t count) {
+
+    struct slab* slab = NULL;
+
+    if ((slab = malloc(sizeof(struct slab) + count * sizeof(struct heap_node))) == NULL) {
+        return NULL;
+    }
+
+    slab->next = NULL;
+
+    *heap->last = slab;
+    heap->last = &slab->next;
+
+    return slab->nodes;
+}
+
+/* ================================ */
+
+/**
+ * \brief Takes an unused element, allocating a slab if there is none.
+ *
+ * \return The element, or `NULL` if there is no memory for it.
+ */
+static struct heap_node* Node_take(const sHeap_t heap) {
+
+    struct heap_node* node = NULL;
+
+    if (heap->free == NULL) {
+
+        if ((node = Slab_new(heap, SLAB_NODES)) == NULL) {
+            return NULL;
+        }
+
+        for (size_t i = 0; i < SLAB_NODES; i++) {
+            node[i].node.data = NULL;
+            node[i].node.next = (i + 1 < SLAB_NODES) ? (sNode_t) &node[i + 1] : NULL;
+
+            node[i].generation = 0;
+        }
+
+        heap->free = node;
+        heap->free_last = &node[SLAB_NODES - 1];
+    }
+
+    node = heap->free;
+    heap->free = Node_sibling(node);
+
+    return node;
+}
+
+/* ================================ */
+
+/**
+ * \brief Puts a removed element on the free list, making the handles to it stale.
+ */
+static void Node_recycle(const sHeap_t heap, struct heap_node* node) {
+
+    node->node.data = NULL;
+    node->generation++;
+
+    if (heap->free == NULL) {
+        heap->free_last = node;
+    }
+
+    node->node.next = (sNode_t) heap->free;
+    heap->free = node;
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * \brief Resolves a handle to an element.
+ *
+ * Whether the element belongs to the queue is not checked: finding its root would take a walk as long as the queue.
+ *
+ * \return The element, or `NULL` if it has been removed.
+ */
+static struct heap_node* Node_resolve(sHNode_t handle) {
+
+    struct heap_node* node = (struct heap_node*) handle.node;
+
+    if ((node->node.data == NULL) || (node->generation != handle.generation)) {
+        return NULL;
+    }
+
+    return node;
+}
+
+/* ================================ */
+
+/**
+ * \brief Cuts an element that is not the root, with its subtree, off its parent and siblings.
+ */
+static void Node_cut(struct heap_node* node) {
+
+    if (node->prev->child == node) {
+        node->prev->child = Node_sibling(node);
+    }
+    else {
+        node->prev->node.next = node->node.next;
+    }
+
+    if (node->node.next != NULL) {
+        Node_sibling(node)->prev = node->prev;
+    }
+
+    node->node.next = NULL;
+    node->prev = NULL;
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * \brief Links two heaps, making the one whose root comes later the first child of the other.
+ *
+ * Both roots must be detached: no siblings and no `prev`.
+ *
+ * \return The root of the linked heap.
+ */
+static struct heap_node* Node_meld(const sHeap_t heap, struct heap_node* a, struct heap_node* b) {
+
+    struct heap_node* t = NULL;
+
+    if (a == NULL) {
+        return b;
+    }
+
+    if (b == NULL) {
+        return a;
+    }
+
+    if (heap->compare(b->node.data, a->node.data) < 0) {
+        t = a;
+        a = b;
+        b = t;
+    }
+
+    b->prev = a;
+    b->node.next = (sNode_t) a->child;
+
+    if (a->child != NULL) {
+        a->child->prev = b;
+    }
+
+    a->child = b;
+
+    return a;
+}
+
+/* ================================ */
+
+/**
+ * \brief Links a chain of siblings into one heap: in pairs from left to right, then the pairs from right to left.
+ *
+ * \return The root of the heap, `NULL` if the chain is empty.
+ */
+static struct heap_node* Node_combine(const sHeap_t heap, struct heap_node* first) {
+
+    struct heap_node* pairs = NULL;
+    struct heap_node* a = NULL;
+    struct heap_node* b = NULL;
+    struct heap_node* root = NULL;
+
+    /* The pairs are stacked up through `node.next`, so popping them goes from right to left */
+    while (first != NULL) {
+
+        a = first;
+        b = Node_sibling(a);
+
+        first = (b != NULL) ? Node_sibling(b) : NULL;
+
+        a->node.next = NULL;
+        a->prev = NULL;
+
+        if (b != NULL) {
+            b->node.next = NULL;
+            b->prev = NULL;
+        }
+
+        a = Node_meld(heap, a, b);
+
+        a->node.next = (sNode_t) pairs;
+        pairs = a;
+    }
+
+    while (pairs != NULL) {
+
+        a = pairs;
+        pairs = Node_sibling(a);
+
+        a->node.next = NULL;
+
+        root = Node_meld(heap, root, a);
+    }
+
+    return root;
+}
+
+/* ================================================================ */
+
+int sHeap_new(sHeap_t* heap, void (*destroy)(void* data), int (*compare)(void* data_1, void* data_2)) {
+
+    if (heap == NULL) {
+        return E_NULL_V;
+    }
+
+    if (compare == NULL) {
+        return E_MISMET;
+    }
+
+    if ((*heap = calloc(1, sizeof(struct heap))) == NULL) {
+        return E_NOMEM;
+    }
+
+    (*heap)->last = &(*heap)->slabs;
+
+    (*heap)->destroy = destroy;
+    (*heap)->compare = compare;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sHeap_destroy(sHeap_t* heap) {
+
+    struct slab* slab = NULL;
+    struct slab* next = NULL;
+
+    struct heap_node* node = NULL;
+    struct heap_node* sibling = NULL;
+
+    if ((heap == NULL) || (*heap == NULL)) {
+        return E_NULL_V;
+    }
+
+    /* Every element in use hangs off the root; flattening the tree onto the sibling chain visits each of them once */
+    for (node = ((*heap)->destroy != NULL) ? (*heap)->root : NULL; node != NULL; node = sibling) {
+
+        if (node->child != NULL) {
+            sibling = node->child;
+
+            for (; Node_sibling(sibling) != NULL; sibling = Node_sibling(sibling)) ;
+
+            sibling->node.next = node->node.next;
+            sibling = node->child;
+        }
+        else {
+            sibling = Node_sibling(node);
+        }
+
+        (*heap)->destroy(node->node.data);
+    }
+
+    for (slab = (*heap)->slabs; slab != NULL; slab = next) {
+        next = slab->next;
+
+        free(slab);
+    }
+
+    free(*heap);
+
+    *heap = NULL;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sHeap_insert(const sHeap_t heap, void* data, sHNode_t* node) {
+
+    struct heap_node* n = NULL;
+
+    if ((heap == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if ((n = Node_take(heap)) == NULL) {
+        return E_NOMEM;
+    }
+
+    n->node.next = NULL;
+    n->node.data = data;
+    n->node.list = NULL;
+
+    n->child = NULL;
+    n->prev = NULL;
+
+    heap->root = Node_meld(heap, heap->root, n);
+    heap->size++;
+
+    if (node != NULL) {
+        node->node = (sNode_t) n;
+        node->generation = n->generation;
+    }
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sHeap_peek_min(const sHeap_t heap, void** data) {
+
+    if ((heap == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if (heap->root == NULL) {
+        return E_NOTFOUND;
+    }
+
+    *data = heap->root->node.data;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sHeap_pop_min(const sHeap_t heap, void** data) {
+
+    struct heap_node* root = NULL;
+
+    if ((heap == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if ((root = heap->root) == NULL) {
+        return E_NOTFOUND;
+    }
+
+    heap->root = Node_combine(heap, root->child);
+    heap->size--;
+
+    *data = root->node.data;
+
+    Node_recycle(heap, root);
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sHeap_decrease_key(const sHeap_t heap, sHNode_t node, void* data) {
+
+    struct heap_node* n = NULL;
+
+    if ((heap == NULL) || (node.node == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if ((n = Node_resolve(node)) == NULL) {
+        return E_MATCH;
+    }
+
+    /* A later key would have to sink into the subtree, which a pairing heap cannot do */
+    if (heap->compare(data, n->node.data) > 0) {
+        return E_INVAL;
+    }
+
+    n->node.data = data;
+
+    /* Cut the element's subtree off its parent and link it back at the root */
+    if (n != heap->root) {
+        Node_cut(n);
+
+        heap->root = Node_meld(heap, heap->root, n);
+    }
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sHeap_remove(const sHeap_t heap, sHNode_t node, void** data) {
+
+    struct heap_node* n = NULL;
+
+    if ((heap == NULL) || (node.node == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if ((n = Node_resolve(node)) == NULL) {
+        return E_MATCH;
+    }
+
+    if (n == heap->root) {
+        return sHeap_pop_min(heap, data);
+    }
+
+    /* The element's children take its place as a heap of their own, linked back at the root */
+    Node_cut(n);
+
+    heap->root = Node_meld(heap, heap->root, Node_combine(heap, n->child));
+    heap->size--;
+
+    *data = n->node.data;
+
+    Node_recycle(heap, n);
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sHeap_merge(const sHeap_t heap, sHeap_t* other) {
+
+    if ((heap == NULL) || (other == NULL) || (*other == NULL)) {
+        return E_NULL_V;
+    }
+
+    if (((*other)->compare != heap->compare) || ((*other)->destroy != heap->destroy)) {
+        return E_MISMET;
+    }
+
+    if (*other == heap) {
+        return E_MATCH;
+    }
+
+    heap->root = Node_meld(heap, heap->root, (*other)->root);
+    heap->size += (*other)->size;
+
+    /* The elements stay where they are, so the slabs change hands */
+    if ((*other)->slabs != NULL) {
+        *heap->last = (*other)->slabs;
+        heap->last = (*other)->last;
+    }
+
+    /* Both free lists are kept, the other queue's in front */
+    if ((*other)->free != NULL) {
+
+        if (heap->free == NULL) {
+            heap->free_last = (*other)->free_last;
+        }
+
+        (*other)->free_last->node.next = (sNode_t) heap->free;
+        heap->free = (*other)->free;
+    }
+
+    free(*other);
+
+    *other = NULL;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sHeap_heapify(const sHeap_t heap, const sList_t list) {
+
+    struct heap_node* nodes = NULL;
+    sNode_t node = NULL;
+
+    ssize_t size = 0;
+
+    if ((heap == NULL) || (list == NULL)) {
+        return E_NULL_V;
+    }
+
+    if ((size = list->data->size) == 0) {
+        return E_OK;
+    }
+
+    /* Copies made by the `_copy` functions live in the list's nodes, which the queue's `destroy` cannot free */
+    for (node = list->data->head; node != NULL; node = node->next) {
+
+        if (Node_is_inline(node)) {
+            return E_MISMET;
+        }
+    }
+
+    if ((nodes = Slab_new(heap, (size_t) size)) == NULL) {
+        return E_NOMEM;
+    }
+
+    /* The list's data becomes a chain of siblings, which is then combined like the children of a removed root */
+    for (ssize_t i = 0; i < size; i++) {
+
+        sList_remove_first(list, &nodes[i].node.data);
+
+        nodes[i].node.next = (i + 1 < size) ? (sNode_t) &nodes[i + 1] : NULL;
+        nodes[i].node.list = NULL;
+
+        nodes[i].child = NULL;
+        nodes[i].prev = NULL;
+
+        nodes[i].generation = 0;
+    }
+
+    nodes = Node_combine(heap, nodes);
+
+    heap->root = Node_meld(heap, heap->root, nodes);
+    heap->size += size;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+ssize_t sHeap_size(const sHeap_t heap) {
+
+    if (heap == NULL) {
+        return -E_NULL_V;
+    }
+
+    return heap->size;
+}
+
+/* ================================================================ */
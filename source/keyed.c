@@ -0,0 +1,452 @@
+#include "../include/sll.h"
+
+/* Vectorized key scans on x86, `SLL_NO_SIMD` leaves only the portable one */
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(SLL_NO_SIMD)
+    #define SLL_SIMD
+    #include <immintrin.h>
+#endif
+
+/* The next chunk's keys are fetched while the current ones are compared, `SLL_NO_PREFETCH` turns it off as in list.c */
+#if defined(__GNUC__) && !defined(SLL_NO_PREFETCH)
+    #define PREFETCH(address) __builtin_prefetch((address), 0, 3)
+#else
+    #define PREFETCH(address) ((void) (address))
+#endif
+
+/* ================================================================ */
+
+/**
+ * Number of elements in a chunk: the keys fill four cache lines, eight AVX2 or sixteen SSE2 registers.
+ * Chunks are allocated one by one, so a scan follows a pointer per chunk; the larger the chunk, the more
+ * keys are compared for every pointer the scan has to wait for.
+ */
+#define CHUNK_SLOTS 64
+
+/* Number of keys in a cache line */
+#define LINE_KEYS 16
+
+/**
+ * A chunk of a keyed list. Keys and data are kept in separate arrays, so a scan reads only keys.
+ * Elements occupy the first `count` slots, in list order.
+ */
+struct chunk {
+
+    _Alignas(64) uint32_t keys[CHUNK_SLOTS];
+
+    void* data[CHUNK_SLOTS];
+
+    struct chunk* next;
+    uint32_t count;
+};
+
+/**
+ * Compares a key with the keys of a chunk.
+ *
+ * \return A mask with bit `i` set if `keys[i]` equals `key`, for every one of the `CHUNK_SLOTS` slots.
+ */
+typedef uint64_t (*scan_t)(const uint32_t* keys, uint32_t key);
+
+/**
+ * A singly-linked list of chunks.
+ */
+struct keyed_list {
+
+    struct chunk* head;
+    struct chunk* tail;
+
+    ssize_t size;                   /**< Number of elements in the list */
+
+    scan_t scan;                    /**< The best scan the CPU supports */
+
+    void (*destroy)(void* data);    /**< See the \ref methods struct */
+};
+
+/* ================================ */
+
+static uint64_t Scan_scalar(const uint32_t* keys, uint32_t key) {
+
+    uint64_t mask = 0;
+
+    for (size_t i = 0; i < CHUNK_SLOTS; i++) {
+        mask |= (uint64_t) (keys[i] == key) << i;
+    }
+
+    return mask;
+}
+
+#ifdef SLL_SIMD
+
+__attribute__((target("sse2")))
+static uint64_t Scan_sse2(const uint32_t* keys, uint32_t key) {
+
+    __m128i k = _mm_set1_epi32((int) key);
+
+    uint64_t mask = 0;
+
+    for (size_t i = 0; i < CHUNK_SLOTS; i += 4) {
+
+        __m128i block = _mm_load_si128((const __m128i*) &keys[i]);
+
+        mask |= (uint64_t) _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, k))) << i;
+    }
+
+    return mask;
+}
+
+__attribute__((target("avx2")))
+static uint64_t Scan_avx2(const uint32_t* keys, uint32_t key) {
+
+    __m256i k = _mm256_set1_epi32((int) key);
+
+    uint64_t mask = 0;
+
+    for (size_t i = 0; i < CHUNK_SLOTS; i += 8) {
+
+        __m256i block = _mm256_load_si256((const __m256i*) &keys[i]);
+
+        mask |= (uint64_t) _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, k))) << i;
+    }
+
+    return mask;
+}
+
+#endif /* SLL_SIMD */
+
+/* ================================ */
+
+/**
+ * \brief Picks the fastest scan the CPU running the program supports.
+ */
+static scan_t Scan_select(void) {
+
+#ifdef SLL_SIMD
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2")) {
+        return Scan_avx2;
+    }
+
+    if (__builtin_cpu_supports("sse2")) {
+        return Scan_sse2;
+    }
+#endif
+
+    return Scan_scalar;
+}
+
+/* ================================ */
+
+/**
+ * \brief Allocates an empty chunk.
+ *
+ * \return The chunk, or `NULL` if there is no memory for it.
+ */
+static struct chunk* Chunk_new(void) {
+
+    struct chunk* chunk = NULL;
+
+    if ((chunk = aligned_alloc(_Alignof(struct chunk), sizeof(struct chunk))) == NULL) {
+        return NULL;
+    }
+
+    /* Slots past `count` are scanned too; their matches are masked off, but they must hold initialized keys */
+    memset(chunk->keys, 0, sizeof(chunk->keys));
+
+    chunk->next = NULL;
+    chunk->count = 0;
+
+    return chunk;
+}
+
+/* ================================ */
+
+/**
+ * \brief Moves the elements of the chunk after a given chunk to the end of that chunk, and frees the emptied one.
+ *
+ * @param[in] list A keyed list.
+ * @param[in] chunk A chunk, with room for the elements of the chunk after it.
+ */
+static void Chunk_absorb(const sKList_t list, struct chunk* chunk) {
+
+    struct chunk* next = chunk->next;
+
+    memcpy(&chunk->keys[chunk->count], next->keys, next->count * sizeof(uint32_t));
+    memcpy(&chunk->data[chunk->count], next->data, next->count * sizeof(void*));
+
+    chunk->count += next->count;
+    chunk->next = next->next;
+
+    if (list->tail == next) {
+        list->tail = chunk;
+    }
+
+    free(next);
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * \brief Finds the first element with a given key.
+ *
+ * @param[in] list A keyed list.
+ * @param[in] key The key.
+ * @param[out] slot A pointer to store the element's slot in its chunk.
+ * @param[out] previous A pointer to store the chunk before the element's chunk, `NULL` if it is the head; may be `NULL`.
+ *
+ * \return The element's chunk, or `NULL` if no element has the key.
+ */
+static struct chunk* Chunk_find(const sKList_t list, uint32_t key, uint32_t* slot, struct chunk** previous) {
+
+    struct chunk* before = NULL;
+    struct chunk* chunk = list->head;
+
+    uint64_t mask = 0;
+
+    for (; chunk != NULL; before = chunk, chunk = chunk->next) {
+
+        /* The load of the next chunk overlaps with the comparisons on this one */
+        if (chunk->next != NULL) {
+
+            for (size_t i = 0; i < CHUNK_SLOTS; i += LINE_KEYS) {
+                PREFETCH(&chunk->next->keys[i]);
+            }
+        }
+
+        /* Chunks are never empty, so `count` is at least 1 */
+        if ((mask = list->scan(chunk->keys, key) & (UINT64_MAX >> (64 - chunk->count))) != 0) {
+            *slot = (uint32_t) __builtin_ctzll(mask);
+
+            if (previous != NULL) {
+                *previous = before;
+            }
+
+            return chunk;
+        }
+    }
+
+    return NULL;
+}
+
+/* ================================================================ */
+
+int sKList_new(sKList_t* list, void (*destroy)(void* data)) {
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    if ((*list = calloc(1, sizeof(struct keyed_list))) == NULL) {
+        return E_NOMEM;
+    }
+
+    (*list)->scan = Scan_select();
+    (*list)->destroy = destroy;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sKList_destroy(sKList_t* list) {
+
+    struct chunk* chunk = NULL;
+    struct chunk* next = NULL;
+
+    if ((list == NULL) || (*list == NULL)) {
+        return E_NULL_V;
+    }
+
+    for (chunk = (*list)->head; chunk != NULL; chunk = next) {
+
+        next = chunk->next;
+
+        if ((*list)->destroy != NULL) {
+
+            for (uint32_t i = 0; i < chunk->count; i++) {
+                (*list)->destroy(chunk->data[i]);
+            }
+        }
+
+        free(chunk);
+    }
+
+    free(*list);
+
+    *list = NULL;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sKList_insert_last(const sKList_t list, uint32_t key, void* data) {
+
+    struct chunk* chunk = NULL;
+
+    if ((list == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if ((list->tail == NULL) || (list->tail->count == CHUNK_SLOTS)) {
+
+        if ((chunk = Chunk_new()) == NULL) {
+            return E_NOMEM;
+        }
+
+        if (list->tail == NULL) {
+            list->head = chunk;
+        }
+        else {
+            list->tail->next = chunk;
+        }
+
+        list->tail = chunk;
+    }
+
+    chunk = list->tail;
+
+    chunk->keys[chunk->count] = key;
+    chunk->data[chunk->count] = data;
+    chunk->count++;
+
+    list->size++;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sKList_insert_first(const sKList_t list, uint32_t key, void* data) {
+
+    struct chunk* chunk = NULL;
+
+    if ((list == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if ((list->head == NULL) || (list->head->count == CHUNK_SLOTS)) {
+
+        if ((chunk = Chunk_new()) == NULL) {
+            return E_NOMEM;
+        }
+
+        if ((chunk->next = list->head) == NULL) {
+            list->tail = chunk;
+        }
+
+        list->head = chunk;
+    }
+
+    chunk = list->head;
+
+    memmove(&chunk->keys[1], &chunk->keys[0], chunk->count * sizeof(uint32_t));
+    memmove(&chunk->data[1], &chunk->data[0], chunk->count * sizeof(void*));
+
+    chunk->keys[0] = key;
+    chunk->data[0] = data;
+    chunk->count++;
+
+    list->size++;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sKList_find(const sKList_t list, uint32_t key, void** data) {
+
+    struct chunk* chunk = NULL;
+
+    uint32_t slot = 0;
+
+    if ((list == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if ((chunk = Chunk_find(list, key, &slot, NULL)) == NULL) {
+        return E_NOTFOUND;
+    }
+
+    *data = chunk->data[slot];
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sKList_remove(const sKList_t list, uint32_t key, void** data) {
+
+    struct chunk* chunk = NULL;
+    struct chunk* previous = NULL;
+
+    uint32_t slot = 0;
+
+    if ((list == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if ((chunk = Chunk_find(list, key, &slot, &previous)) == NULL) {
+        return E_NOTFOUND;
+    }
+
+    *data = chunk->data[slot];
+
+    chunk->count--;
+
+    memmove(&chunk->keys[slot], &chunk->keys[slot + 1], (chunk->count - slot) * sizeof(uint32_t));
+    memmove(&chunk->data[slot], &chunk->data[slot + 1], (chunk->count - slot) * sizeof(void*));
+
+    /* A chunk merges with a neighbour it fits in, so removes do not leave a trail of sparse chunks behind */
+    if ((previous != NULL) && (previous->count + chunk->count <= CHUNK_SLOTS)) {
+        Chunk_absorb(list, previous);
+    }
+    else if ((chunk->next != NULL) && (chunk->count + chunk->next->count <= CHUNK_SLOTS)) {
+        Chunk_absorb(list, chunk);
+    }
+    /* The only chunk left: empty chunks are unlinked, so a scan never meets one */
+    else if (chunk->count == 0) {
+        list->head = NULL;
+        list->tail = NULL;
+
+        free(chunk);
+    }
+
+    list->size--;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sKList_foreach(const sKList_t list, int (*func)(void* data)) {
+
+    int result = E_OK;
+
+    if ((list == NULL) || (func == NULL)) {
+        return E_NULL_V;
+    }
+
+    for (struct chunk* chunk = list->head; chunk != NULL; chunk = chunk->next) {
+
+        for (uint32_t i = 0; i < chunk->count; i++) {
+            result += func(chunk->data[i]);
+        }
+    }
+
+    return result;
+}
+
+/* ================================ */
+
+ssize_t sKList_size(const sKList_t list) {
+
+    if (list == NULL) {
+        return -E_NULL_V;
+    }
+
+    return list->size;
+}
+
+/* ================================================================ */
@@ -1,83 +1,186 @@
 #include "../include/sll.h"
+#include "../include/internal.h"
+
+#include <pthread.h>
+
+#include <unistd.h>
+
+#ifdef __linux__
+    #include <sys/eventfd.h>
+#endif
 
 /* ================================================================ */
 
 /**
- * 
+ * Traversal loops that call a user function for every node prefetch the node after the next one,
+ * together with the data of the next node, so those loads are in flight while the user function runs.
+ * Define `SLL_NO_PREFETCH` (`make PREFETCH=0`) on platforms where software prefetching does not pay off.
  */
-struct singly_linked_list_node {
+#if defined(__GNUC__) && !defined(SLL_NO_PREFETCH)
+    #define PREFETCH(address) __builtin_prefetch((address), 0, 3)
+#else
+    #define PREFETCH(address) ((void) (address))
+#endif
 
-    sNode_t next;   /**< A pointer to the next node in a singly-linked list */
+/**
+ * Static tracepoints for perf and bpftrace, built in with `make TRACE=1` (`SLL_TRACE`), which needs `sys/sdt.h`.
+ * Every probe of the `sll` provider reports the list, its size after the operation and the number of nodes the
+ * operation walked through. A probe nobody is attached to costs one `nop`; without `SLL_TRACE` none are compiled in.
+ * See the scripts in `trace/`.
+ */
+#ifdef SLL_TRACE
+    #include <sys/sdt.h>
+    #define TRACE(probe, list, size, nodes) DTRACE_PROBE3(sll, probe, (list), (size), (nodes))
+#else
+    #define TRACE(probe, list, size, nodes) ((void) (nodes))
+#endif
 
-    void* data;     /**< Node's data */
+/* ================================================================ */
 
-    sList_t list;   /**< The list a node belongs to */
-};
+/**
+ * The state of \ref sList_next: the list being iterated over and the node whose data is returned next.
+ * It lives at file scope so that removing that node or destroying the list does not leave it dangling.
+ */
+static struct {
+    sList_t list;
+    sNode_t node;
+} iterator = {NULL, NULL};
+
+/* ================================ */
 
 /**
- * The `methods` struct encapsulates all the methods available for a list.
- * It serves as a container for the function pointers that define the behavior and operations supported by the list,
- * providing a unified interface to interact with the list's functionality.
- * 
- * The methods struct is defined as an incomplete data type, 
- * which means that its function pointers are not specified within the struct definition.
- * Instead, the function pointers are defined separately in the code where the methods struct is used.
+ * The state of a list in sync mode, see \ref sList_set_sync.
  */
-struct methods {
-
-    /**
-     * \brief Provides a way to free dynamically allocated data when \link sList_destroy \endlink is called.
-     * 
-     * Provides a way to free dynamically allocated data when \link sList_destroy \endlink is called.
-     * For example, if the list contains data dynamically allocated using `malloc`,
-     * destroy should be set to `free` to free the data as the linked list is destroyed. 
-     * For structured data containing several dynamically allocated members, `destroy` should be set to a user-defined function
-     * that calls `free` for each dynamically allocated member as well as for the structure itself.
-     * For a linked list containing data that should not be freed, `destroy` should be set to `NULL`.
-     * 
-     * @param[in] data Node's data
-     * 
-     * \return None
-     */
-    void (*destroy)(void* data);
-
-    /**
-     * \brief Provides a way to display Node's data.
-     * 
-     * The `print` method is used to output the data held by each node in the singly-linked list.
-     * It does this by traversing the list and calling the user-defined `print` function for each node's data.
-     * 
-     * @param[in] data Node's data.
-     * 
-     * \return None.
-    */
-    void (*print)(void* data);
-
-    /**
-     * \brief Provides a way to compare data stored in a node.
-     * 
-     * The `match` method is a user-defined function that compares the data held by a node with arbitrary data.
-     * 
-     * @param[in] data_1 The data held by the node
-     * @param[in] data_2 The data to be compared with the node's data.
-     * 
-     * \return `0` if the two values are equal, indicating a successful match; any non-zero value if the two values are not equal, indicating a mismatch.
-     */
-    int (*match)(void* data_1, void* data_2);
+struct sync {
+
+    pthread_mutex_t lock;           /**< Recursive, so locked functions can call each other */
+    pthread_cond_t available;       /**< Signaled when an element is inserted and a consumer waits */
+    pthread_cond_t room;            /**< Broadcast when the list is below its limits and a producer waits */
+
+    size_t waiters;                 /**< Consumers sleeping in \ref sList_pop_wait */
+    size_t producers;               /**< Producers sleeping until a full list has room */
+
+    int eventfd;                    /**< Readable while the list is not empty, -1 if not requested */
+    int readable;                   /**< Non-zero if the eventfd's counter is not zero */
 };
 
+/* ================================ */
+
 /**
- * A singly-linked list data.
+ * A counting Bloom filter over the data of a list, see \ref sList_set_bloom. Each element increments `hashes`
+ * counters picked by its hash; a counter that reaches `UINT8_MAX` stays there, so removals never cause false negatives.
  */
-struct data {
-    ssize_t size;   /**< Number of elements in a singly-linked list */
+struct bloom {
 
-    sNode_t head;   /**< The first node of the singly-linked list */
-    sNode_t tail;   /**< The last node of the singly-linked list */
+    size_t mask;                    /**< The number of counters minus one */
+    unsigned int hashes;            /**< The number of counters per element */
+
+    uint8_t counters[];
 };
 
 /* ================================ */
 
+/**
+ * \brief Tells whether a list has no room for one more element holding a given number of bytes.
+ */
+static int List_full(const sList_t list, size_t bytes) {
+
+    if ((list->data->max_size > 0) && ((size_t) list->data->size >= list->data->max_size)) {
+        return 1;
+    }
+
+    return (list->data->max_bytes > 0) && (list->data->bytes + bytes > list->data->max_bytes);
+}
+
+/* ================================ */
+
+/**
+ * \brief Locks a list in sync mode; does nothing for other lists.
+ */
+static void Sync_lock(const sList_t list) {
+
+    if (list->data->sync != NULL) {
+        pthread_mutex_lock(&list->data->sync->lock);
+    }
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * \brief Unlocks a list in sync mode, first waking a consumer and updating the eventfd if the list has changed.
+ */
+static void Sync_unlock(const sList_t list) {
+
+    struct sync* sync = list->data->sync;
+
+    if (sync == NULL) {
+        return ;
+    }
+
+#ifdef __linux__
+    /* The counter is kept at 1 while there are elements and drained once there are none */
+    if ((sync->eventfd >= 0) && ((list->data->size > 0) != sync->readable)) {
+
+        eventfd_t count = 1;
+
+        if (sync->readable) {
+            eventfd_read(sync->eventfd, &count);
+        }
+        else {
+            eventfd_write(sync->eventfd, count);
+        }
+
+        sync->readable = !sync->readable;
+    }
+#endif
+
+    if ((sync->waiters > 0) && (list->data->size > 0)) {
+        pthread_cond_signal(&sync->available);
+    }
+
+    /* Waiting elements may differ in size, so every producer gets to check whether its own fits */
+    if ((sync->producers > 0) && !List_full(list, 0)) {
+        pthread_cond_broadcast(&sync->room);
+    }
+
+    pthread_mutex_unlock(&sync->lock);
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * The allocator of lists created by \ref sList_new: `malloc` and `free`.
+ */
+static void* Default_alloc(void* context, size_t size) {
+
+    (void) context;
+
+    return malloc(size);
+}
+
+static void Default_free(void* context, void* pointer) {
+
+    (void) context;
+
+    free(pointer);
+
+    return ;
+}
+
+static const sAllocator_t default_allocator = {Default_alloc, Default_free, NULL, 0};
+
+/* ================================ */
+
+int Allocator_is_default(const sAllocator_t* allocator) {
+    return allocator->free == Default_free;
+}
+
+/* ================================ */
+
 /**
  * \brief Creates a new instance of a list node.
  * 
@@ -85,12 +188,13 @@ struct data {
  * field with the provided value. If the `data` argument is NULL, the function
  * will return NULL, indicating an error.
  * 
+ * @param[in] list The list whose allocator provides the node.
  * @param[in] data A void pointer to the data to be stored in the node.
  * @param[out] node A pointer that the function writes into.
  * 
  * \return 0 on success, a non-zero value otherwise.
  */
-static int Node_new(void* data, sNode_t* node) {
+static int Node_new(const sList_t list, void* data, sNode_t* node) {
 
     sNode_t n = NULL;
 
@@ -98,11 +202,14 @@ static int Node_new(void* data, sNode_t* node) {
         return E_NULL_V;
     }
 
-    if ((n = calloc(1, sizeof(struct singly_linked_list_node))) == NULL) {
+    /* Every field is set below, so the memory does not need to be zeroed */
+    if ((n = list->data->allocator.alloc(list->data->allocator.context, sizeof(struct singly_linked_list_node))) == NULL) {
         return E_NOMEM;
     }
 
+    n->next = NULL;
     n->data = data;
+    n->list = NULL;
 
     *node = n;
 
@@ -112,106 +219,243 @@ static int Node_new(void* data, sNode_t* node) {
 /* ================================ */
 
 /**
- * \brief Destroys a list node and frees its associated memory.
- * 
- * This function deallocates the memory occupied by the provided list node
- * and calls the user-defined `destroy` function to free the node's data.
+ * \brief Creates a new instance of a list node holding a copy of the given bytes.
  * 
- * @param[in] node A pointer to the list node to be destroyed.
+ * The copy and the node share one allocation: the copy comes first, so that `data` is the
+ * start of the allocation and can be released like any other allocation, and the node follows it.
  * 
- * @remark The `destroy` function should be implemented by the user and will be
- *         responsible for freeing the memory occupied by the data stored in the
+ * @param[in] list The list whose allocator provides the node.
+ * @param[in] bytes The bytes to be copied into the node.
+ * @param[in] length The number of bytes to copy.
+ * @param[out] node A pointer that the function writes into.
  * 
  * \return 0 on success, a non-zero value otherwise.
  */
-static int Node_destroy(sNode_t* node, void** data) {
+static int Node_copy(const sList_t list, const void* bytes, size_t length, sNode_t* node) {
 
-    if ((node == NULL) || (*node == NULL)) {
+    sNode_t n = NULL;
+
+    unsigned char* block = NULL;
+
+    /* The node must be suitably aligned after the copy */
+    size_t offset = (length + _Alignof(struct singly_linked_list_node) - 1) & ~(_Alignof(struct singly_linked_list_node) - 1);
+
+    if ((bytes == NULL) || (length == 0)) {
         return E_NULL_V;
     }
 
-    *data = (*node)->data;
-    
-    free(*node);
+    if ((block = list->data->allocator.alloc(list->data->allocator.context, offset + sizeof(struct singly_linked_list_node))) == NULL) {
+        return E_NOMEM;
+    }
 
-    /* Upon return the node is NULL */
-    *node = NULL;
+    memcpy(block, bytes, length);
+
+    n = (sNode_t) (block + offset);
+
+    n->next = NULL;
+    n->data = block;
+    n->list = (sList_t) NODE_INLINE;
+
+    *node = n;
 
     return E_OK;
 }
 
-/* ================================================================ */
+/* ================================ */
 
-int sList_new(sList_t* list, void (*destroy)(void* data), void (*print)(void* data), int (*match)(void* data_1, void* data_2)) {
+/**
+ * \brief Returns the memory a node accounts for in its list: the node and its data's payload, or the whole block of an inline node.
+ */
+static size_t Node_bytes(const sList_t list, const sNode_t node) {
 
-    if ((*list = calloc(1, sizeof(struct singly_linked_list))) == NULL) {
-        return E_NOMEM;
+    if (Node_is_inline(node)) {
+        return (size_t) ((unsigned char*) node - (unsigned char*) node->data) + sizeof(struct singly_linked_list_node);
     }
 
-    if (((*list)->methods = calloc(1, sizeof(struct methods))) == NULL) {
-        sList_destroy(list);
+    return (Node_in_block(node) ? sizeof(struct block_node) : sizeof(struct singly_linked_list_node)) + ((list->methods->payload != NULL) ? list->methods->payload(node->data) : 0);
+}
 
-        return E_NOMEM;
+/* ================================ */
+
+/**
+ * \brief Charges a new node to a list if the list's limits leave room for it, or releases the node otherwise.
+ *
+ * @param[in] list A list, locked if it is in sync mode.
+ * @param[in] node A node not yet linked into the list.
+ * @param[in] wait Non-zero to wait for room rather than fail; only for lists in sync mode.
+ *
+ * \return 0 on success, `E_FULL` if there is no room for the node.
+ */
+static int Node_admit(const sList_t list, const sNode_t node, int wait) {
+
+    struct sync* sync = list->data->sync;
+
+    size_t bytes = Node_bytes(list, node);
+
+    /* A node larger than the whole budget would wait forever */
+    int fits = (list->data->max_bytes == 0) || (bytes <= list->data->max_bytes);
+
+    while (fits && List_full(list, bytes)) {
+
+        if (!wait || (sync == NULL)) {
+            fits = 0;
+
+            break ;
+        }
+
+        sync->producers++;
+        pthread_cond_wait(&sync->room, &sync->lock);
+        sync->producers--;
     }
 
-    if (((*list)->data = calloc(1, sizeof (struct data))) == NULL) {
-        sList_destroy(list);
+    if (!fits) {
+        Allocator_free(&list->data->allocator, Node_is_inline(node) ? node->data : (void*) node);
 
-        return E_NOMEM;
+        return E_FULL;
     }
 
-    (*list)->methods->destroy = destroy;
-    (*list)->methods->print = print;
-    (*list)->methods->match = match;
+    list->data->bytes += bytes;
 
     return E_OK;
 }
 
 /* ================================ */
 
-int sList_destroy(sList_t* list) {
+#define LN2 0.69314718055994530942
 
-    int result = E_OK;
+/**
+ * \brief Returns the natural logarithm of a positive number, without making users of the library link against libm.
+ */
+static double Bloom_log(double x) {
 
-    void* data = NULL;
+    double result = 0;
+    double t = 0;
+    double term = 0;
 
-    if ((list == NULL) || (*list == NULL)) {
-        return E_NULL_V;
+    /* x = m 2^e with m in [1, 2) */
+    for (; x >= 2; x /= 2) {
+        result += LN2;
     }
 
-    while ((*list)->data->size > 0) {
+    for (; x < 1; x *= 2) {
+        result -= LN2;
+    }
 
-        result = sList_remove_first(*list, &data);
+    /* ln m = 2 atanh((m - 1) / (m + 1)), whose series converges quickly as (m - 1) / (m + 1) < 1/3 */
+    t = (x - 1) / (x + 1);
+    term = t;
 
-        if ((*list)->methods->destroy != NULL) {
-            (*list)->methods->destroy(data);
-        }
+    for (int i = 1; i < 32; i += 2) {
+        result += 2 * term / i;
+        term *= t * t;
     }
 
-    free((*list)->data);
-    free((*list)->methods);
-    free(*list);
+    return result;
+}
 
-    *list = NULL;
+/* ================================ */
 
-    return result;
+/**
+ * \brief Derives the two hashes a Bloom filter's counters are picked with from the `hash` method.
+ *
+ * The method's hash is mixed first, since user hashes of small integers are often the integers themselves.
+ */
+static void Bloom_hash(const sList_t list, void* data, uint64_t* h1, uint64_t* h2) {
+
+    uint64_t h = (uint64_t) list->methods->hash(data);
+
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+
+    *h1 = h;
+    *h2 = ((h >> 32) | (h << 32)) | 1;
+
+    return ;
 }
 
 /* ================================ */
 
-int sList_insert_last(const sList_t list, void* data) {
+/**
+ * \brief Adds `delta`, 1 or -1, to the counters of some data in a list's Bloom filter; does nothing without a filter.
+ */
+static void Bloom_count(const sList_t list, void* data, int delta) {
 
-    int result = E_OK;
-    sNode_t node = NULL;
+    struct bloom* bloom = list->data->bloom;
 
-    if (list == NULL) {
-        return E_NULL_V;
+    uint64_t h1 = 0;
+    uint64_t h2 = 0;
+
+    if (bloom == NULL) {
+        return ;
     }
 
-    if ((result = Node_new(data, &node)) != E_OK) {
-        return result;
+    Bloom_hash(list, data, &h1, &h2);
+
+    for (unsigned int i = 0; i < bloom->hashes; i++, h1 += h2) {
+
+        uint8_t* counter = &bloom->counters[h1 & bloom->mask];
+
+        /* A saturated counter no longer knows how many elements it counts */
+        if (*counter != UINT8_MAX) {
+            *counter += delta;
+        }
+    }
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * \brief Tells whether some data may be in a list, according to the list's Bloom filter.
+ *
+ * \return Zero if the data is certainly not in the list.
+ */
+static int Bloom_contains(const sList_t list, void* data) {
+
+    struct bloom* bloom = list->data->bloom;
+
+    uint64_t h1 = 0;
+    uint64_t h2 = 0;
+
+    Bloom_hash(list, data, &h1, &h2);
+
+    for (unsigned int i = 0; i < bloom->hashes; i++, h1 += h2) {
+
+        if (bloom->counters[h1 & bloom->mask] == 0) {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/* ================================ */
+
+/**
+ * \brief Recounts the elements of a list into its Bloom filter, after the filter or the `hash` method has changed.
+ */
+static void Bloom_fill(const sList_t list) {
+
+    memset(list->data->bloom->counters, 0, list->data->bloom->mask + 1);
+
+    for (sNode_t node = list->data->head; node != NULL; node = node->next) {
+        Bloom_count(list, node->data, 1);
     }
 
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * \brief Appends a node to a list.
+ */
+static void Node_link_last(const sList_t list, const sNode_t node) {
+
     if (list->data->size == 0) {
         list->data->head = list->data->tail = node;
     }
@@ -220,360 +464,1691 @@ int sList_insert_last(const sList_t list, void* data) {
         list->data->tail = node;
     }
 
-    list->data->size++;
+    list->data->size++;
+
+    Node_set_list(node, list);
+
+    Bloom_count(list, node->data, 1);
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * \brief Prepends a node to a list.
+ */
+static void Node_link_first(const sList_t list, const sNode_t node) {
+
+    if (list->data->size == 0) {
+        list->data->head = list->data->tail = node;
+    }
+    else {
+        node->next = list->data->head;
+        list->data->head = node;
+    }
+
+    list->data->size++;
+    list->data->finger_index++;
+
+    Node_set_list(node, list);
+
+    Bloom_count(list, node->data, 1);
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * \brief Links a node after a given node of a list, which is not the list's tail.
+ */
+static void Node_link_after(const sList_t list, const sNode_t node, const sNode_t new_node) {
+
+    new_node->next = node->next;
+    node->next = new_node;
+
+    list->data->size++;
+
+    /* The position of `node` is unknown, so the new node may have shifted the finger */
+    if (node != list->data->finger) {
+        list->data->finger = NULL;
+    }
+
+    Node_set_list(new_node, list);
+
+    Bloom_count(list, new_node->data, 1);
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * \brief Destroys a list node and frees its associated memory.
+ * 
+ * This function deallocates the memory occupied by the provided list node
+ * and calls the user-defined `destroy` function to free the node's data.
+ * 
+ * @param[in] list The list whose allocator the node came from.
+ * @param[in] node A pointer to the list node to be destroyed.
+ * 
+ * @remark The `destroy` function should be implemented by the user and will be
+ *         responsible for freeing the memory occupied by the data stored in the
+ * 
+ * \return 0 on success, a non-zero value otherwise.
+ */
+static int Node_destroy(const sList_t list, sNode_t* node, void** data) {
+
+    if ((node == NULL) || (*node == NULL)) {
+        return E_NULL_V;
+    }
+
+    *data = (*node)->data;
+
+    /* The iterator moves on to the node that follows */
+    if (iterator.node == *node) {
+        iterator.node = (*node)->next;
+    }
+
+    if (list->data->finger == *node) {
+        list->data->finger = NULL;
+    }
+
+    list->data->bytes -= Node_bytes(list, *node);
+
+    Bloom_count(list, (*node)->data, -1);
+
+    /* An inline node is part of the data's allocation, which now belongs to the caller */
+    if (!Node_is_inline(*node)) {
+        Node_release(&list->data->allocator, *node);
+    }
+
+    /* Upon return the node is NULL */
+    *node = NULL;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+sNode_t Node_at(const sList_t list, ssize_t index, size_t* nodes) {
+
+    sNode_t node = list->data->head;
+    ssize_t i = 0;
+
+    if (index == list->data->size - 1) {
+        node = list->data->tail;
+        i = index;
+    }
+    else if ((list->data->finger != NULL) && (list->data->finger_index <= index)) {
+        node = list->data->finger;
+        i = list->data->finger_index;
+    }
+
+    if (nodes != NULL) {
+        *nodes = (size_t) (index - i);
+    }
+
+    for (; i < index; i++) {
+        node = node->next;
+    }
+
+    list->data->finger = node;
+    list->data->finger_index = index;
+
+    return node;
+}
+
+/* ================================ */
+
+/**
+ * \brief Disposes of data removed from a list on the list's behalf.
+ *
+ * The data is passed to the list's `destroy` method, or retired if snapshots may still refer to it.
+ * Copies made by the `_copy` functions are freed even if the list has no `destroy` method, and those from
+ * a custom allocator go back to it whatever the `destroy` method is.
+ *
+ * @param[in] list The list the data has been removed from.
+ * @param[in] data The data.
+ * @param[in] copy Non-zero if the data was held by an inline node.
+ */
+static void Data_discard(const sList_t list, void* data, int copy) {
+
+    void (*destroy)(void* data) = list->methods->destroy;
+
+    const sAllocator_t* allocator = NULL;
+
+    if (copy) {
+
+        if (!Allocator_is_default(&list->data->allocator)) {
+            destroy = NULL;
+            allocator = &list->data->allocator;
+        }
+        else if (destroy == NULL) {
+            destroy = free;
+        }
+    }
+
+    if ((destroy == NULL) && (allocator == NULL)) {
+        return ;
+    }
+
+    /* Readers may still hold snapshots that refer to the data; if it cannot be retired, it is leaked rather than freed under them */
+    if (list->data->snapshot != NULL) {
+        Snapshot_retire(list->data->snapshot, data, destroy, allocator);
+    }
+    else if (destroy != NULL) {
+        destroy(data);
+    }
+    else {
+        Allocator_free(allocator, data);
+    }
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * \brief Unlinks a node from a list and disposes of it and its data, see \ref Data_discard.
+ *
+ * @param[in] list A list.
+ * @param[in] previous The node before `node`, `NULL` if `node` is the head.
+ * @param[in] node The node.
+ */
+static void Node_discard(const sList_t list, const sNode_t previous, sNode_t node) {
+
+    void* data = NULL;
+
+    int copy = Node_is_inline(node);
+
+    if (previous == NULL) {
+        list->data->head = node->next;
+    }
+    else {
+        previous->next = node->next;
+    }
+
+    if (node == list->data->tail) {
+        list->data->tail = previous;
+    }
+
+    list->data->size--;
+
+    Node_destroy(list, &node, &data);
+    Data_discard(list, data, copy);
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * A share of the data copied by \ref sList_clone_parallel: a run of consecutive nodes of the clone's block.
+ */
+struct clone_job {
+
+    struct block_node* nodes;
+    size_t count;
+
+    void* (*copy)(void* data);
+
+    size_t failed;      /**< Number of copies that returned `NULL` */
+};
+
+/**
+ * \brief Replaces the data of a run of nodes with copies of it.
+ */
+static void* Clone_copy(void* arg) {
+
+    struct clone_job* job = arg;
+
+    for (size_t i = 0; i < job->count; i++) {
+
+        if ((job->nodes[i].node.data = job->copy(job->nodes[i].node.data)) == NULL) {
+            job->failed++;
+        }
+    }
+
+    return NULL;
+}
+
+/* ================================================================ */
+
+int sList_new(sList_t* list, void (*destroy)(void* data), void (*print)(void* data), int (*match)(void* data_1, void* data_2)) {
+    return sList_new_with_allocator(list, destroy, print, match, NULL);
+}
+
+/* ================================ */
+
+int sList_new_with_allocator(sList_t* list, void (*destroy)(void* data), void (*print)(void* data), int (*match)(void* data_1, void* data_2), const sAllocator_t* allocator) {
+
+    if (allocator == NULL) {
+        allocator = &default_allocator;
+    }
+
+    if (allocator->alloc == NULL) {
+        return E_MISMET;
+    }
+
+    if ((*list = allocator->alloc(allocator->context, sizeof(struct singly_linked_list))) == NULL) {
+        return E_NOMEM;
+    }
+
+    (*list)->methods = NULL;
+
+    /* `sList_destroy` cannot be used here, it expects a fully constructed list */
+    if ((((*list)->methods = allocator->alloc(allocator->context, sizeof(struct methods))) == NULL) || (((*list)->data = allocator->alloc(allocator->context, sizeof (struct data))) == NULL)) {
+
+        if ((*list)->methods != NULL) {
+            Allocator_free(allocator, (*list)->methods);
+        }
+
+        Allocator_free(allocator, *list);
+
+        *list = NULL;
+
+        return E_NOMEM;
+    }
+
+    /* Zeroing is skipped when the allocator has already done it */
+    if (!allocator->zeroed) {
+        memset((*list)->methods, 0, sizeof(struct methods));
+        memset((*list)->data, 0, sizeof(struct data));
+    }
+
+    (*list)->data->allocator = *allocator;
+
+    (*list)->methods->destroy = destroy;
+    (*list)->methods->print = print;
+    (*list)->methods->match = match;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sList_destroy(sList_t* list) {
+
+    int result = E_OK;
+    int copy = 0;
+
+    void* data = NULL;
+
+    sAllocator_t allocator;
+
+    if ((list == NULL) || (*list == NULL)) {
+        return E_NULL_V;
+    }
+
+    allocator = (*list)->data->allocator;
+
+    TRACE(destroy, *list, 0, (*list)->data->size);
+
+    while ((*list)->data->size > 0) {
+
+        copy = Node_is_inline((*list)->data->head);
+
+        result = sList_remove_first(*list, &data);
+
+        Data_discard(*list, data, copy);
+    }
+
+    Snapshot_drop((*list)->data->snapshot);
+
+    Iterator_forget(*list);
+
+    if ((*list)->data->sync != NULL) {
+
+#ifdef __linux__
+        if ((*list)->data->sync->eventfd >= 0) {
+            close((*list)->data->sync->eventfd);
+        }
+#endif
+
+        pthread_cond_destroy(&(*list)->data->sync->available);
+        pthread_cond_destroy(&(*list)->data->sync->room);
+        pthread_mutex_destroy(&(*list)->data->sync->lock);
+
+        Allocator_free(&allocator, (*list)->data->sync);
+    }
+
+    if ((*list)->data->bloom != NULL) {
+        Allocator_free(&allocator, (*list)->data->bloom);
+    }
+
+    Allocator_free(&allocator, (*list)->data);
+    Allocator_free(&allocator, (*list)->methods);
+    Allocator_free(&allocator, *list);
+
+    *list = NULL;
+
+    return result;
+}
+
+/* ================================ */
+
+int sList_insert_last(const sList_t list, void* data) {
+
+    int result = E_OK;
+    sNode_t node = NULL;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    if ((result = Node_new(list, data, &node)) != E_OK) {
+        return result;
+    }
+
+    Sync_lock(list);
+
+    if ((result = Node_admit(list, node, list->data->block)) == E_OK) {
+        Node_link_last(list, node);
+    }
+
+    TRACE(insert_last, list, list->data->size, 0);
+
+    Sync_unlock(list);
+
+    return result;
+}
+
+/* ================================ */
+
+int sList_insert_last_copy(const sList_t list, const void* bytes, size_t length) {
+
+    int result = E_OK;
+    sNode_t node = NULL;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    if ((result = Node_copy(list, bytes, length, &node)) != E_OK) {
+        return result;
+    }
+
+    Sync_lock(list);
+
+    if ((result = Node_admit(list, node, list->data->block)) == E_OK) {
+        Node_link_last(list, node);
+    }
+
+    TRACE(insert_last, list, list->data->size, 0);
+
+    Sync_unlock(list);
+
+    return result;
+}
+
+/* ================================ */
+
+int sList_remove_last(const sList_t list, void** data) {
+
+    int result = E_OK;
+
+    ssize_t size;
+
+    sNode_t node = NULL;
+    sNode_t temp = NULL;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    Sync_lock(list);
+
+    size = list->data->size;
+
+    if (size > 0) {
+
+        *data = list->data->tail->data;
+        node = list->data->tail;
+
+        if (size == 1) {
+            list->data->head = (list->data->tail = NULL);
+        }
+        else {
+
+            for (temp = list->data->head; temp->next != list->data->tail; temp = temp->next) ;
+
+            list->data->tail = temp;
+            list->data->tail->next = NULL;
+        }
+
+        result = Node_destroy(list, &node, data);
+
+        list->data->size--;
+    }
+
+    /* The walk to the node before the tail is what makes removing the last element expensive */
+    TRACE(remove_last, list, list->data->size, (size > 1) ? size - 1 : 0);
+
+    Sync_unlock(list);
+
+    return result;
+}
+
+/* ================================ */
+
+ssize_t sList_size(const sList_t list) {
+
+    if (list == NULL) {
+        return -E_NULL_V;
+    }
+
+    return list->data->size;
+}
+
+/* ================================ */
+
+int sList_peek_first(const sList_t list, void** data) {
+
+    if ((list == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    *data = (list->data->size > 0) ? list->data->head->data : NULL;
+
+    return (*data != NULL) ? E_OK : E_NULL_V;
+}
+
+/* ================================ */
+
+int sList_peek_last(const sList_t list, void** data) {
+
+    if ((list == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    *data = (list->data->size > 0) ? list->data->tail->data : NULL;
+
+    return (*data != NULL) ? E_OK : E_NULL_V;
+}
+
+/* ================================ */
+
+int sList_print(const sList_t list, const char* delimiter) {
+
+    sNode_t node = NULL;
+    sNode_t next = NULL;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    /* The absence of a print method is not an error */
+    if (list->methods->print == NULL) {
+        return E_MISMET;
+    }
+
+    for (node = list->data->head; node != NULL; node = next) {
+
+        if ((next = node->next) != NULL) {
+            PREFETCH(next->next);
+            PREFETCH(next->data);
+        }
+
+        list->methods->print(node->data);
+
+        if (node != list->data->tail) {
+            printf("%s", (delimiter != NULL) ? delimiter : " -> ");
+        }
+    }
+
+    printf("\n");
+
+    return 0;
+}
+
+/* ================================ */
+
+int sList_insert_first(const sList_t list, void* data) {
+
+    int result = E_OK;
+    sNode_t node = NULL;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    if ((result = Node_new(list, data, &node)) != E_OK) {
+        return result;
+    }
+
+    Sync_lock(list);
+
+    if ((result = Node_admit(list, node, list->data->block)) == E_OK) {
+        Node_link_first(list, node);
+    }
+
+    TRACE(insert_first, list, list->data->size, 0);
+
+    Sync_unlock(list);
+
+    return result;
+}
+
+/* ================================ */
+
+int sList_insert_first_copy(const sList_t list, const void* bytes, size_t length) {
+
+    int result = E_OK;
+    sNode_t node = NULL;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    if ((result = Node_copy(list, bytes, length, &node)) != E_OK) {
+        return result;
+    }
+
+    Sync_lock(list);
+
+    if ((result = Node_admit(list, node, list->data->block)) == E_OK) {
+        Node_link_first(list, node);
+    }
+
+    TRACE(insert_first, list, list->data->size, 0);
+
+    Sync_unlock(list);
+
+    return result;
+}
+
+/* ================================ */
+
+int sList_remove_first(const sList_t list, void** data) {
+
+    int result = E_OK;
+
+    ssize_t size = 0;
+
+    sNode_t node = NULL;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    Sync_lock(list);
+
+    size = list->data->size;
+
+    if (size > 0) {
+
+        *data = list->data->head->data;
+        node = list->data->head;
+
+        if (size == 1) {
+            list->data->head = list->data->tail = NULL;
+        }
+        else {
+            list->data->head = list->data->head->next;
+        }
+
+        list->data->finger_index--;
+
+        result = Node_destroy(list, &node, data);
+
+        list->data->size--;
+    }
+
+    TRACE(remove_first, list, list->data->size, 0);
+
+    Sync_unlock(list);
+
+    return result;
+}
+
+/* ================================ */
+
+int sList_find(const sList_t list, void* data, sNode_t* node) {
+
+    int result = E_OK;
+
+    sNode_t temp = NULL;
+    sNode_t next = NULL;
+
+    size_t nodes = 0;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    if (list->methods->match == NULL) {
+        return E_MISMET;
+    }
+
+    if (data == NULL) {
+        return E_NULL_V;
+    }
+
+    /* A definite miss needs no walk */
+    if ((list->data->bloom != NULL) && !Bloom_contains(list, data)) {
+        TRACE(find, list, list->data->size, 0);
+
+        return result;
+    }
+
+    for (temp = list->data->head; temp != NULL; temp = next) {
+
+        if ((next = temp->next) != NULL) {
+            PREFETCH(next->next);
+            PREFETCH(next->data);
+        }
+
+        nodes++;
+
+        if (list->methods->match(temp->data, data) == 0) {
+
+            *node = temp;
+
+            TRACE(find, list, list->data->size, nodes);
+
+            return result;
+        }
+    }
+
+    TRACE(find, list, list->data->size, nodes);
+
+    return result;
+}
+
+/* ================================ */
+
+int sList_insert_after(const sList_t list, const sNode_t node, void* data) {
+
+    sNode_t new_node = NULL;
+
+    int result = 0;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    if ((node == NULL) || (node == list->data->tail)) {
+        return sList_insert_last(list, data);
+    }
+
+    /* The node is simply belongs to another node, so there is no meaning in insertion of a node after "this" node in the given list */
+    if (Node_list(node) != list) {
+        return E_MATCH;
+    }
+
+    if (((result = Node_new(list, data, &new_node)) != 0) || ((result = Node_admit(list, new_node, 0)) != E_OK)) {
+        return result;
+    }
+
+    Node_link_after(list, node, new_node);
+
+    TRACE(insert_after, list, list->data->size, 0);
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sList_insert_after_copy(const sList_t list, const sNode_t node, const void* bytes, size_t length) {
+
+    sNode_t new_node = NULL;
+
+    int result = 0;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    if ((node == NULL) || (node == list->data->tail)) {
+        return sList_insert_last_copy(list, bytes, length);
+    }
+
+    if (Node_list(node) != list) {
+        return E_MATCH;
+    }
+
+    if (((result = Node_copy(list, bytes, length, &new_node)) != 0) || ((result = Node_admit(list, new_node, 0)) != E_OK)) {
+        return result;
+    }
+
+    Node_link_after(list, node, new_node);
+
+    TRACE(insert_after, list, list->data->size, 0);
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sList_insert_before(const sList_t list, const sNode_t node, void* data) {
+
+    sNode_t new_node = NULL;
+    sNode_t temp = NULL;
+
+    size_t nodes = 0;
+
+    int result = E_OK;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    if ((node == NULL) || (node == list->data->head)) {
+        return sList_insert_first(list, data);
+    }
+
+    if (Node_list(node) != list) {
+        return E_MATCH;
+    }
+
+    for (temp = list->data->head; (temp != NULL) && (temp->next != node); temp = temp->next) {
+        nodes++;
+    }
+
+    /* The node claims to belong to the list, but it is not linked into it */
+    if (temp == NULL) {
+        return E_MATCH;
+    }
+
+    if (((result = Node_new(list, data, &new_node)) != 0) || ((result = Node_admit(list, new_node, 0)) != E_OK)) {
+        return result;
+    }
+
+    Node_link_after(list, temp, new_node);
+
+    TRACE(insert_before, list, list->data->size, nodes + 1);
+
+    return result;
+}
+
+/* ================================ */
+
+int sList_delete_Node(const sList_t list, sNode_t node, void** data) {
+
+    int result = E_OK;
+
+    sNode_t temp = NULL;
+
+    size_t nodes = 0;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    if (node == NULL) {
+        return E_NULL_V;
+    }
+
+    if (node == list->data->head) {
+        return sList_remove_first(list, data);
+    }
+
+    if (node == list->data->tail) {
+        return sList_remove_last(list, data);
+    }
+
+    if (Node_list(node) != list) {
+        return E_MATCH;
+    }
+
+    for (temp = list->data->head; (temp != NULL) && (temp->next != node); temp = temp->next) {
+        nodes++;
+    }
+
+    if (temp == NULL) {
+        return E_MATCH;
+    }
+
+    temp->next = node->next;
+
+    /* The walk did not count positions */
+    list->data->finger = NULL;
+
+    result = Node_destroy(list, &node, data);
+
+    list->data->size--;
+
+    TRACE(delete_node, list, list->data->size, nodes + 1);
+
+    return result;
+}
+
+/* ================================ */
+
+int sList_print_verbose(const sList_t list) {
+
+    sNode_t node = NULL;
+
+    if (list == NULL) {
+        return -E_NULL_V;
+    }
+
+    if (list->methods->print == NULL) {
+        return E_MISMET;
+    }
+
+    for (node = list->data->head; node != NULL; node = node->next) {
+
+        printf("[");
+        printf("current: %p\n", (void*) node);
+        printf(" data: {");
+        list->methods->print(node->data);
+        printf("}\n");
+
+        printf(" next: %p", (void*) node->next);
+        printf("]\n");
+
+        if (node != list->data->tail) {
+            printf("\n");
+        }
+    }
+
+    printf("\n");
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sList_foreach(const sList_t list, int (*func)(void* data)) {
+
+    int result = E_OK;
+
+    sNode_t node = NULL;
+    sNode_t next = NULL;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    if (func == NULL) {
+        return E_NULL_V;
+    }
+
+    for (node = list->data->head; node != NULL; node = next) {
+
+        if ((next = node->next) != NULL) {
+            PREFETCH(next->next);
+            PREFETCH(next->data);
+        }
+
+        result += func(node->data);
+    }
+
+    TRACE(foreach, list, list->data->size, list->data->size);
+
+    return result;
+}
+
+/* ================================ */
+
+int sList_at(const sList_t list, size_t index, void** data) {
+
+    if ((list == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if (index >= (size_t) list->data->size) {
+        return E_NOTFOUND;
+    }
+
+    *data = Node_at(list, (ssize_t) index, NULL)->data;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sList_insert_at(const sList_t list, size_t index, void* data) {
+
+    sNode_t node = NULL;
+    sNode_t new_node = NULL;
+
+    size_t nodes = 0;
+
+    int result = E_OK;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    if (index > (size_t) list->data->size) {
+        return E_NOTFOUND;
+    }
+
+    if (index == 0) {
+        return sList_insert_first(list, data);
+    }
+
+    if (index == (size_t) list->data->size) {
+        return sList_insert_last(list, data);
+    }
+
+    if (((result = Node_new(list, data, &new_node)) != E_OK) || ((result = Node_admit(list, new_node, 0)) != E_OK)) {
+        return result;
+    }
+
+    /* The predecessor becomes the finger, so linking after it keeps the finger valid */
+    node = Node_at(list, (ssize_t) index - 1, &nodes);
+
+    Node_link_after(list, node, new_node);
+
+    TRACE(insert_at, list, list->data->size, nodes);
+
+    return result;
+}
+
+/* ================================ */
+
+int sList_remove_at(const sList_t list, size_t index, void** data) {
+
+    sNode_t node = NULL;
+    sNode_t previous = NULL;
+
+    size_t nodes = 0;
+
+    int result = E_OK;
+
+    if ((list == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if (index >= (size_t) list->data->size) {
+        return E_NOTFOUND;
+    }
+
+    if (index == 0) {
+        return sList_remove_first(list, data);
+    }
+
+    previous = Node_at(list, (ssize_t) index - 1, &nodes);
+
+    node = previous->next;
+    previous->next = node->next;
+
+    if (node == list->data->tail) {
+        list->data->tail = previous;
+    }
+
+    result = Node_destroy(list, &node, data);
+
+    list->data->size--;
+
+    TRACE(remove_at, list, list->data->size, nodes);
+
+    return result;
+}
+
+/* ================================ */
+
+int sList_set_hash(const sList_t list, size_t (*hash)(void* data)) {
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    /* The filter cannot work without hashes */
+    if ((hash == NULL) && (list->data->bloom != NULL)) {
+        sList_set_bloom(list, 0, 0);
+    }
+
+    list->methods->hash = hash;
+
+    if (list->data->bloom != NULL) {
+        Bloom_fill(list);
+    }
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sList_set_bloom(const sList_t list, size_t expected, double rate) {
+
+    struct bloom* bloom = NULL;
+
+    double bits = 0;
+    double probes = 0;
+    size_t counters = 0;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    if (expected > 0) {
+
+        if (list->methods->hash == NULL) {
+            return E_MISMET;
+        }
+
+        if (!((rate > 0) && (rate < 1))) {
+            return E_INVAL;
+        }
+
+        /* The optimal filter has -n ln p / (ln 2)^2 counters, probed ln 2 times per counter per element */
+        bits = -(double) expected * Bloom_log(rate) / (LN2 * LN2);
+
+        /* A filter that could not be allocated anyway is refused before its size overflows */
+        for (counters = 64; ((double) counters < bits) && (counters <= (SIZE_MAX - sizeof(struct bloom)) / 2); counters <<= 1) ;
+
+        if ((double) counters < bits) {
+            return E_NOMEM;
+        }
+
+        if ((bloom = list->data->allocator.alloc(list->data->allocator.context, sizeof(struct bloom) + counters)) == NULL) {
+            return E_NOMEM;
+        }
+
+        /* The optimal number of probes, counters / n * ln 2, rounded to the nearest and kept within [1, 16] */
+        probes = (double) counters / (double) expected * LN2;
+
+        bloom->mask = counters - 1;
+        bloom->hashes = (probes < 16) ? (unsigned int) (probes + 0.5) : 16;
+
+        if (bloom->hashes == 0) {
+            bloom->hashes = 1;
+        }
+    }
+
+    if (list->data->bloom != NULL) {
+        Allocator_free(&list->data->allocator, list->data->bloom);
+    }
+
+    if ((list->data->bloom = bloom) != NULL) {
+        Bloom_fill(list);
+    }
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sList_filter(const sList_t list, int (*predicate)(void* data)) {
+
+    sNode_t previous = NULL;
+    sNode_t node = NULL;
+    sNode_t next = NULL;
+
+    size_t nodes = 0;
+
+    if ((list == NULL) || (predicate == NULL)) {
+        return E_NULL_V;
+    }
+
+    nodes = (size_t) list->data->size;
+
+    for (node = list->data->head; node != NULL; node = next) {
+
+        next = node->next;
+
+        if (predicate(node->data)) {
+            previous = node;
+        }
+        else {
+            Node_discard(list, previous, node);
+        }
+    }
+
+    list->data->finger = NULL;
+
+    TRACE(filter, list, list->data->size, nodes);
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sList_partition(const sList_t list, int (*predicate)(void* data), sList_t* out) {
+
+    sNode_t previous = NULL;
+    sNode_t node = NULL;
+    sNode_t next = NULL;
+
+    size_t nodes = 0;
+
+    int result = E_OK;
+
+    if ((list == NULL) || (predicate == NULL) || (out == NULL)) {
+        return E_NULL_V;
+    }
+
+    nodes = (size_t) list->data->size;
+
+    /* Nodes keep coming from the same allocator, whichever list they end up in */
+    if ((result = sList_new_with_allocator(out, list->methods->destroy, list->methods->print, list->methods->match, &list->data->allocator)) != E_OK) {
+        return result;
+    }
+
+    (*out)->methods->hash = list->methods->hash;
+    (*out)->methods->payload = list->methods->payload;
+
+    /* Readers of the list's snapshots may still refer to the data moved out */
+    if ((result = Snapshot_inherit(list, *out)) != E_OK) {
+        sList_destroy(out);
+
+        return result;
+    }
+
+    Iterator_forget(list);
+
+    for (node = list->data->head; node != NULL; node = next) {
+
+        next = node->next;
+
+        if (predicate(node->data)) {
+            previous = node;
+
+            continue ;
+        }
+
+        if (previous == NULL) {
+            list->data->head = next;
+        }
+        else {
+            previous->next = next;
+        }
+
+        if (node == list->data->tail) {
+            list->data->tail = previous;
+        }
+
+        list->data->size--;
+        list->data->bytes -= Node_bytes(list, node);
+
+        Bloom_count(list, node->data, -1);
+
+        node->next = NULL;
+        Node_link_last(*out, node);
+
+        (*out)->data->bytes += Node_bytes(*out, node);
+    }
+
+    list->data->finger = NULL;
 
-    node->list = list;
+    TRACE(partition, list, list->data->size, nodes);
 
     return result;
 }
 
 /* ================================ */
 
-int sList_remove_last(const sList_t list, void** data) {
-
-    int result = E_OK;
-
-    ssize_t size;
+int sList_reverse(const sList_t list) {
 
+    sNode_t previous = NULL;
     sNode_t node = NULL;
-    sNode_t temp = NULL;
+    sNode_t next = NULL;
 
     if (list == NULL) {
         return E_NULL_V;
     }
 
-    size = list->data->size;
-
-    if (size > 0) {
-
-        *data = list->data->tail->data;
-        node = list->data->tail;
+    /* The iterator would otherwise carry on in the new order from where it was */
+    Iterator_forget(list);
 
-        if (size == 1) {
-            list->data->head = (list->data->tail = NULL);
-        }
-        else {
+    for (node = list->data->head; node != NULL; node = next) {
 
-            for (temp = list->data->head; temp->next != list->data->tail; temp = temp->next) ;
+        next = node->next;
+        node->next = previous;
 
-            list->data->tail = temp;
-            list->data->tail->next = NULL;
-        }
+        previous = node;
+    }
 
-        result = Node_destroy(&node, data);
+    list->data->tail = list->data->head;
+    list->data->head = previous;
 
-        list->data->size--;
-    }
+    list->data->finger_index = list->data->size - 1 - list->data->finger_index;
 
-    return result;
+    return E_OK;
 }
 
 /* ================================ */
 
-ssize_t sList_size(const sList_t list) {
+/**
+ * \brief Looks a node's data up in a table of the distinct data seen so far, adding it if it is not there.
+ *
+ * \return Non-zero if matching data was already in the table.
+ */
+static int Table_seen(const sList_t list, sNode_t* table, size_t mask, const sNode_t node) {
 
-    if (list == NULL) {
-        return -E_NULL_V;
+    size_t i = list->methods->hash(node->data) & mask;
+
+    for (; table[i] != NULL; i = (i + 1) & mask) {
+
+        if (list->methods->match(table[i]->data, node->data) == 0) {
+            return 1;
+        }
     }
 
-    return list->data->size;
+    table[i] = node;
+
+    return 0;
 }
 
 /* ================================ */
 
-int sList_print(const sList_t list, const char* delimiter) {
+int sList_unique(const sList_t list) {
 
+    sNode_t* table = NULL;
+    size_t mask = 0;
+
+    sNode_t previous = NULL;
     sNode_t node = NULL;
+    sNode_t next = NULL;
+    sNode_t kept = NULL;
+
+    size_t nodes = 0;
+
+    int seen = 0;
 
     if (list == NULL) {
         return E_NULL_V;
     }
 
-    /* The absence of a print method is not an error */
-    if (list->methods->print == NULL) {
+    if (list->methods->match == NULL) {
         return E_MISMET;
     }
 
-    for (node = list->data->head; node != NULL; node = node->next) {
+    /* An open-addressing table at most half full; without a `hash` method, or memory for it, every node is compared with the ones kept before it */
+    if (list->methods->hash != NULL) {
 
-        list->methods->print(node->data);
+        for (mask = 1; mask < 2 * (size_t) list->data->size; mask <<= 1) ;
 
-        if (node != list->data->tail) {
-            printf("%s", (delimiter != NULL) ? delimiter : " -> ");
+        if ((table = calloc(mask, sizeof(sNode_t))) != NULL) {
+            mask--;
         }
     }
 
-    printf("\n");
+    for (node = list->data->head; node != NULL; node = next) {
 
-    return 0;
+        next = node->next;
+        nodes++;
+
+        if (table != NULL) {
+            seen = Table_seen(list, table, mask, node);
+        }
+        else {
+            /* Without a table the walk goes over the kept nodes again for every node, which the probe shows */
+            for (kept = list->data->head, seen = 0; (kept != node) && !seen; kept = kept->next) {
+                seen = (list->methods->match(kept->data, node->data) == 0);
+                nodes++;
+            }
+        }
+
+        if (seen) {
+            Node_discard(list, previous, node);
+        }
+        else {
+            previous = node;
+        }
+    }
+
+    free(table);
+
+    list->data->finger = NULL;
+
+    TRACE(unique, list, list->data->size, nodes);
+
+    return E_OK;
 }
 
 /* ================================ */
 
-int sList_insert_first(const sList_t list, void* data) {
+int sList_clone(const sList_t list, sList_t* clone, void* (*copy)(void* data)) {
+    return sList_clone_parallel(list, clone, copy, 1);
+}
+
+/* ================================ */
+
+int sList_clone_parallel(const sList_t list, sList_t* clone, void* (*copy)(void* data), size_t threads) {
+
+    struct node_block* block = NULL;
+    struct block_node* nodes = NULL;
+    struct clone_job* jobs = NULL;
+    struct clone_job single;
+
+    pthread_t* workers = NULL;
 
-    int result = E_OK;
     sNode_t node = NULL;
+    sNode_t n = NULL;
 
-    if (list == NULL) {
+    size_t used = 0;
+    size_t failed = 0;
+
+    int result = E_OK;
+
+    if ((list == NULL) || (clone == NULL)) {
         return E_NULL_V;
     }
 
-    if ((result = Node_new(data, &node)) != E_OK) {
+    /* Without a copy the clone shares the data, which only works if neither list destroys it */
+    if ((copy == NULL) && (list->methods->destroy != NULL)) {
+        return E_MISMET;
+    }
+
+    if ((result = sList_new_with_allocator(clone, list->methods->destroy, list->methods->print, list->methods->match, &list->data->allocator)) != E_OK) {
         return result;
     }
 
+    (*clone)->methods->hash = list->methods->hash;
+    (*clone)->methods->payload = list->methods->payload;
+
     if (list->data->size == 0) {
-        list->data->head = list->data->tail = node;
+        return E_OK;
     }
-    else {
-        node->next = list->data->head;
-        list->data->head = node;
+
+    /* One block for every node; those of inline elements, which are copied with their nodes, go unused */
+    if ((block = list->data->allocator.alloc(list->data->allocator.context, sizeof(struct node_block) + (size_t) list->data->size * sizeof(struct block_node))) == NULL) {
+        sList_destroy(clone);
+
+        return E_NOMEM;
     }
 
-    list->data->size++;
+    block->live = 0;
+    nodes = (struct block_node*) (block + 1);
 
-    node->list = list;
+    for (node = list->data->head; node != NULL; node = node->next) {
 
-    return result;
-}
+        if (Node_is_inline(node)) {
 
-/* ================================ */
+            if ((result = Node_copy(*clone, node->data, (size_t) ((unsigned char*) node - (unsigned char*) node->data), &n)) != E_OK) {
+                break ;
+            }
 
-int sList_remove_first(const sList_t list, void** data) {
+            (*clone)->data->bytes += Node_bytes(*clone, n);
+        }
+        else {
+            n = &nodes[used].node;
 
-    int result = E_OK;
+            n->data = node->data;
+            n->list = (sList_t) NODE_BLOCK;
 
-    ssize_t size = 0;
+            nodes[used++].block = block;
+            block->live++;
+        }
 
-    sNode_t node = NULL;
+        n->next = NULL;
+        Node_link_last(*clone, n);
+    }
 
-    if (list == NULL) {
-        return E_NULL_V;
+    if (block->live == 0) {
+        Allocator_free(&list->data->allocator, block);
     }
 
-    size = list->data->size;
+    if ((copy != NULL) && (used > 0) && (result == E_OK)) {
 
-    if (size > 0) {
+        if (threads == 0) {
+            threads = (size_t) sysconf(_SC_NPROCESSORS_ONLN);
+        }
 
-        *data = list->data->head->data;
-        node = list->data->head;
+        threads = (threads > used) ? used : ((threads == 0) ? 1 : threads);
 
-        if (size == 1) {
-            list->data->head = list->data->tail = NULL;
-        }
-        else {
-            list->data->head = list->data->head->next;
+        /* Without memory to keep track of threads, everything is copied by the calling thread */
+        if ((threads == 1) || ((jobs = calloc(threads, sizeof(struct clone_job))) == NULL) || ((workers = calloc(threads, sizeof(pthread_t))) == NULL)) {
+            free(jobs);
+
+            jobs = &single;
+            threads = 1;
         }
 
-        result = Node_destroy(&node, data);
+        /* Consecutive runs of the block; the calling thread copies the first one */
+        for (size_t i = 0, start = 0; i < threads; i++) {
 
-        list->data->size--;
-    }
+            jobs[i].nodes = &nodes[start];
+            jobs[i].count = used / threads + (i < used % threads);
+            jobs[i].copy = copy;
+            jobs[i].failed = 0;
 
-    return result;
-}
+            start += jobs[i].count;
 
-/* ================================ */
+            if ((i > 0) && (pthread_create(&workers[i], NULL, Clone_copy, &jobs[i]) != 0)) {
+                jobs[i].copy = NULL;
+            }
+        }
 
-int sList_find(const sList_t list, void* data, sNode_t* node) {
+        for (size_t i = 0; i < threads; i++) {
 
-    int result = E_OK;
+            if ((i == 0) || (jobs[i].copy == NULL)) {
+                jobs[i].copy = copy;
 
-    sNode_t temp = NULL;
+                Clone_copy(&jobs[i]);
+            }
+            else {
+                pthread_join(workers[i], NULL);
+            }
 
-    if (list == NULL) {
-        return E_OK;
-    }
+            failed += jobs[i].failed;
+        }
 
-    if (list->methods->match == NULL) {
-        return E_MISMET;
-    }
+        if (jobs != &single) {
+            free(workers);
+            free(jobs);
+        }
 
-    if (data == NULL) {
-        return E_NULL_V;
+        /* Every node now holds a copy, or `NULL` where the copy failed */
+        if (failed > 0) {
+
+            for (size_t i = 0; i < used; i++) {
+
+                if ((nodes[i].node.data != NULL) && (list->methods->destroy != NULL)) {
+                    list->methods->destroy(nodes[i].node.data);
+                }
+            }
+
+            result = E_NOMEM;
+        }
     }
 
-    for (temp = list->data->head; temp != NULL; temp = temp->next) {
+    /* The clone's data has been destroyed or still belongs to the original list, so only nodes and inline copies are freed */
+    if (result != E_OK) {
+        (*clone)->methods->destroy = NULL;
+        (*clone)->methods->payload = NULL;
 
-        if (list->methods->match(temp->data, data) == 0) {
+        sList_destroy(clone);
 
-            *node = temp;
+        return result;
+    }
 
-            return result;
-        }
+    for (size_t i = 0; i < used; i++) {
+        (*clone)->data->bytes += Node_bytes(*clone, &nodes[i].node);
     }
 
-    return result;
+    return E_OK;
 }
 
 /* ================================ */
 
-int sList_insert_after(const sList_t list, const sNode_t node, void* data) {
+int sList_set_sync(const sList_t list) {
 
-    sNode_t new_node = NULL;
+    struct sync* sync = NULL;
 
-    int result = 0;
+    pthread_mutexattr_t mutex_attributes;
+    pthread_condattr_t cond_attributes;
 
     if (list == NULL) {
         return E_NULL_V;
     }
 
-    if ((node == NULL) || (node == list->data->tail)) {
-        return sList_insert_last(list, data);
+    if (list->data->sync != NULL) {
+        return E_OK;
     }
 
-    /* The node is simply belongs to another node, so there is no meaning in insertion of a node after "this" node in the given list */
-    if (node->list != list) {
-        return E_MATCH;
+    if ((sync = list->data->allocator.alloc(list->data->allocator.context, sizeof(struct sync))) == NULL) {
+        return E_NOMEM;
     }
 
-    if ((result = Node_new(data, &new_node)) != 0) {
-        return result;
-    }
+    pthread_mutexattr_init(&mutex_attributes);
+    pthread_mutexattr_settype(&mutex_attributes, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&sync->lock, &mutex_attributes);
+    pthread_mutexattr_destroy(&mutex_attributes);
 
-    new_node->next = node->next;
-    node->next = new_node;
+    /* Timeouts are measured on the monotonic clock, so changing the system time does not stretch or cut them */
+    pthread_condattr_init(&cond_attributes);
+    pthread_condattr_setclock(&cond_attributes, CLOCK_MONOTONIC);
+    pthread_cond_init(&sync->available, &cond_attributes);
+    pthread_cond_init(&sync->room, &cond_attributes);
+    pthread_condattr_destroy(&cond_attributes);
 
-    list->data->size++;
+    sync->waiters = 0;
+    sync->producers = 0;
+    sync->eventfd = -1;
+    sync->readable = 0;
 
-    new_node->list = list;
+    list->data->sync = sync;
 
     return E_OK;
 }
 
 /* ================================ */
 
-int sList_insert_before(const sList_t list, const sNode_t node, void* data) {
-
-    sNode_t new_node = NULL;
-    sNode_t temp = NULL;
+int sList_eventfd(const sList_t list, int* fd) {
 
     int result = E_OK;
 
-    if (list == NULL) {
+    if ((list == NULL) || (fd == NULL)) {
         return E_NULL_V;
     }
 
-    if ((node == NULL) || (node == list->data->head)) {
-        return sList_insert_first(list, data);
+#ifdef __linux__
+    if ((result = sList_set_sync(list)) != E_OK) {
+        return result;
     }
 
-    if (node->list != list) {
-        return E_MISMET;
-    }
+    Sync_lock(list);
 
-    for (temp = list->data->head; temp->next != node && temp != NULL; temp = temp->next) ;
+    if (list->data->sync->eventfd < 0) {
 
-    if ((result = Node_new(data, &new_node)) != 0) {
-        return result;
+        if ((list->data->sync->eventfd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) < 0) {
+            result = E_NOMEM;
+        }
     }
 
-    new_node->next = temp->next;
-    temp->next = new_node;
+    *fd = list->data->sync->eventfd;
 
-    list->data->size++;
-
-    new_node->list = list;
+    /* Unlocking makes the eventfd readable if the list already has elements */
+    Sync_unlock(list);
+#else
+    result = E_MISMET;
+#endif
 
     return result;
 }
 
 /* ================================ */
 
-int sList_delete_Node(const sList_t list, sNode_t node, void** data) {
+int sList_pop_wait(const sList_t list, void** data, long timeout) {
 
-    int result = E_OK;
+    struct sync* sync = NULL;
+    struct timespec deadline;
 
-    sNode_t temp = NULL;
+    int result = E_OK;
 
-    if (list == NULL) {
+    if ((list == NULL) || (data == NULL)) {
         return E_NULL_V;
     }
 
-    if (node == NULL) {
-        return E_NULL_V;
+    if ((sync = list->data->sync) == NULL) {
+        return E_MISMET;
     }
 
-    if (node == list->data->head) {
-        return sList_remove_first(list, data);
-    }
+    if (timeout > 0) {
+        clock_gettime(CLOCK_MONOTONIC, &deadline);
 
-    if (node == list->data->tail) {
-        return sList_remove_last(list, data);
-    }
+        deadline.tv_sec += timeout / 1000;
+        deadline.tv_nsec += (timeout % 1000) * 1000000;
 
-    if (node->list != list) {
-        return E_MATCH;
+        if (deadline.tv_nsec >= 1000000000) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000;
+        }
     }
 
-    for (temp = list->data->head; temp->next != node && temp != NULL; temp = temp->next) ;
+    Sync_lock(list);
 
-    temp->next = node->next;
+    while ((list->data->size == 0) && (timeout != 0) && (result == E_OK)) {
 
-    result = Node_destroy(&node, data);
+        sync->waiters++;
 
-    list->data->size--;
+        if (timeout < 0) {
+            pthread_cond_wait(&sync->available, &sync->lock);
+        }
+        else if (pthread_cond_timedwait(&sync->available, &sync->lock, &deadline) == ETIMEDOUT) {
+            result = E_TIMEOUT;
+        }
+
+        sync->waiters--;
+    }
+
+    /* An element may have arrived just as the wait timed out */
+    result = (list->data->size > 0) ? sList_remove_first(list, data) : E_TIMEOUT;
+
+    Sync_unlock(list);
 
     return result;
 }
 
 /* ================================ */
 
-int sList_print_verbose(const sList_t list) {
+int sList_set_payload(const sList_t list, size_t (*payload)(void* data)) {
 
     sNode_t node = NULL;
 
     if (list == NULL) {
-        return -E_NULL_V;
-    }
-
-    if (list->methods->print == NULL) {
-        return E_MISMET;
+        return E_NULL_V;
     }
 
-    for (node = list->data->head; node != NULL; node = node->next) {
+    Sync_lock(list);
 
-        printf("[");
-        printf("current: %p\n", (void*) node);
-        printf(" data: {");
-        list->methods->print(node->data);
-        printf("}\n");
+    list->methods->payload = payload;
 
-        printf(" next: %p", (void*) node->next);
-        printf("]\n");
+    /* Elements already in the list are accounted for again, so removing them later credits what was charged */
+    list->data->bytes = 0;
 
-        if (node != list->data->tail) {
-            printf("\n");
-        }
+    for (node = list->data->head; node != NULL; node = node->next) {
+        list->data->bytes += Node_bytes(list, node);
     }
 
-    printf("\n");
+    Sync_unlock(list);
 
     return E_OK;
 }
 
 /* ================================ */
 
-int sList_foreach(const sList_t list, int (*func)(void* data)) {
+int sList_set_limits(const sList_t list, size_t max_size, size_t max_bytes, int block) {
 
     int result = E_OK;
 
-    sNode_t node = NULL;
-
     if (list == NULL) {
         return E_NULL_V;
     }
 
-    if (func == NULL) {
-        return E_NULL_V;
+    if (block && ((result = sList_set_sync(list)) != E_OK)) {
+        return result;
     }
 
-    for (node = list->data->head; node != NULL; node = node->next) {
-        result += func(node->data);
+    Sync_lock(list);
+
+    list->data->max_size = max_size;
+    list->data->max_bytes = max_bytes;
+    list->data->block = block;
+
+    /* Raised limits let waiting producers in */
+    Sync_unlock(list);
+
+    return E_OK;
+}
+
+/* ================================ */
+
+ssize_t sList_bytes(const sList_t list) {
+
+    if (list == NULL) {
+        return -E_NULL_V;
     }
 
-    return result;
+    return (ssize_t) list->data->bytes;
 }
 
 /* ================================ */
@@ -584,43 +2159,51 @@ int sNode_belongs(const sNode_t node, const sList_t list) {
         return E_NULL_V;
     }
 
-    return !(node->list == list);
+    return !(Node_list(node) == list);
 }
 
 /* ================================ */
 
-int sList_next(const sList_t list, void** data) {
+void Iterator_forget(const sList_t list) {
+
+    if (iterator.list == list) {
+        iterator.list = NULL;
+        iterator.node = NULL;
+    }
+
+    return ;
+}
 
-    /* List that is being operated on */
-    static sList_t l = NULL;
+/* ================================ */
 
-    /* The list node whose data was returned by the previous call */
-    static sNode_t n = NULL;
+int sList_next(const sList_t list, void** data) {
 
     // The first time the function is being called requires us to set up its internals
     // or
     // when the new list specified does not match the one specified in the iterator.
-    if ((l == NULL) || ((l != list) && (list != NULL))) {
+    if ((iterator.list == NULL) || ((iterator.list != list) && (list != NULL))) {
 
-        l = list;
-
-        if (list->data->size > 0) {
-            n = list->data->head;
-        }
+        iterator.list = list;
+        iterator.node = NULL;
     }
 
-    if (l == NULL) {
+    if (iterator.list == NULL) {
         return E_NULL_V;
     }
 
-    *data = n->data;
-
-    n = n->next;
+    /* Start over from the head once the end has been reached, or when the list had no nodes before */
+    if (iterator.node == NULL) {
+        iterator.node = iterator.list->data->head;
+    }
 
-    if (n == NULL) {
-        n = list->data->head;
+    if (iterator.node == NULL) {
+        return E_NULL_V;
     }
 
+    *data = iterator.node->data;
+
+    iterator.node = iterator.node->next;
+
     return E_OK;
 }
 
@@ -636,9 +2219,19 @@ void sList_error(int code) {
         {E_NULL_V, "\033[0;35mWarning\033[0;37m: NULL value provided"},
         {E_NOMEM, "\033[0;31mError\033[0;37m: Out of memory"},
         {E_MISMET, "\033[0;35mWarning\033[0;37m: List method is missing"},
-        {E_MATCH, "Foreign node"}
+        {E_MATCH, "Foreign node"},
+        {E_NOTFOUND, "\033[0;35mWarning\033[0;37m: No matching element"},
+        {E_TIMEOUT, "\033[0;35mWarning\033[0;37m: Timed out"},
+        {E_FULL, "\033[0;35mWarning\033[0;37m: List is full"},
+        {E_INVAL, "\033[0;35mWarning\033[0;37m: Invalid argument"}
     };
 
+    if ((code < 0) || ((size_t) code >= sizeof(errors) / sizeof(errors[0]))) {
+        fprintf(stderr, "Unknown error: %d\n", code);
+
+        return ;
+    }
+
     fprintf(stderr, "%s\n", errors[code].msg);
 
     return ;
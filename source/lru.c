@@ -0,0 +1,394 @@
+#include "../include/sll.h"
+
+#include <stdint.h>
+
+/* ================================================================ */
+
+/* Number of buckets a cache starts with, always a power of two */
+#define LRU_BUCKETS 16
+
+/**
+ * An element of a cache. It is linked into the recency list and into the chain of its hash bucket.
+ */
+struct lru_entry {
+
+    struct lru_entry* prev;     /**< The more recently used neighbour */
+    struct lru_entry* next;     /**< The less recently used neighbour */
+
+    struct lru_entry* chain;    /**< The next entry in the same bucket */
+
+    size_t hash;                /**< The hash of the entry's data, kept for rehashing */
+
+    void* data;                 /**< Entry's data */
+};
+
+/**
+ * A least-recently-used cache: a doubly-linked recency list indexed by a chained hash table.
+ */
+struct lru {
+
+    struct lru_entry* head;     /**< The most recently used entry */
+    struct lru_entry* tail;     /**< The least recently used entry, the next one to be evicted */
+
+    struct lru_entry** buckets;
+    unsigned int bits;          /**< The table has `1 << bits` buckets */
+
+    ssize_t size;               /**< Number of entries in the cache */
+    size_t capacity;            /**< Maximum number of entries, 0 if the cache is unbounded */
+
+    void (*destroy)(void* data);                /**< Frees evicted and replaced data, as in \ref methods */
+    size_t (*hash)(void* data);                 /**< Hashes data and keys alike */
+    int (*match)(void* data_1, void* data_2);   /**< Compares data with a key, as in \ref methods */
+};
+
+/* ================================ */
+
+/**
+ * \brief Maps a hash to a bucket.
+ *
+ * The hash is scrambled with Fibonacci hashing, so weak user hashes still spread over the table.
+ */
+static size_t Bucket(const sLRU_t lru, size_t hash) {
+    return (size_t) (((uint64_t) hash * UINT64_C(11400714819323198485)) >> (64 - lru->bits));
+}
+
+/* ================================ */
+
+/**
+ * \brief Looks up the entry that matches a given key.
+ *
+ * @param[in] lru A cache.
+ * @param[in] key A key.
+ * @param[out] link A pointer to the link that refers to the entry in its bucket chain, may be `NULL`.
+ *
+ * \return The entry, or `NULL` if no entry matches.
+ */
+static struct lru_entry* Entry_find(const sLRU_t lru, void* key, struct lru_entry*** link) {
+
+    size_t hash = lru->hash(key);
+
+    struct lru_entry** l = &lru->buckets[Bucket(lru, hash)];
+
+    for (; *l != NULL; l = &(*l)->chain) {
+
+        if (((*l)->hash == hash) && (lru->match((*l)->data, key) == 0)) {
+            break ;
+        }
+    }
+
+    if (link != NULL) {
+        *link = l;
+    }
+
+    return *l;
+}
+
+/* ================================ */
+
+/**
+ * \brief Unlinks an entry from the recency list.
+ */
+static void Entry_unlink(const sLRU_t lru, struct lru_entry* entry) {
+
+    if (entry->prev != NULL) {
+        entry->prev->next = entry->next;
+    }
+    else {
+        lru->head = entry->next;
+    }
+
+    if (entry->next != NULL) {
+        entry->next->prev = entry->prev;
+    }
+    else {
+        lru->tail = entry->prev;
+    }
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * \brief Makes an entry the most recently used one.
+ */
+static void Entry_push_front(const sLRU_t lru, struct lru_entry* entry) {
+
+    entry->prev = NULL;
+    entry->next = lru->head;
+
+    if (lru->head != NULL) {
+        lru->head->prev = entry;
+    }
+    else {
+        lru->tail = entry;
+    }
+
+    lru->head = entry;
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * \brief Removes an entry from the cache and frees it, storing its data in `data`.
+ */
+static void Entry_remove(const sLRU_t lru, struct lru_entry* entry, void** data) {
+
+    struct lru_entry** link = &lru->buckets[Bucket(lru, entry->hash)];
+
+    for (; *link != entry; link = &(*link)->chain) ;
+
+    *link = entry->chain;
+
+    Entry_unlink(lru, entry);
+
+    *data = entry->data;
+
+    free(entry);
+
+    lru->size--;
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * \brief Doubles the number of buckets.
+ *
+ * \return 0 on success, a non-zero value otherwise. On failure the table is left as it was.
+ */
+static int Table_grow(const sLRU_t lru) {
+
+    struct lru_entry** buckets = NULL;
+    struct lru_entry* entry = NULL;
+
+    if ((buckets = calloc((size_t) 1 << (lru->bits + 1), sizeof(struct lru_entry*))) == NULL) {
+        return E_NOMEM;
+    }
+
+    free(lru->buckets);
+
+    lru->buckets = buckets;
+    lru->bits++;
+
+    /* Every entry is on the recency list, which is cheaper to walk than the old buckets */
+    for (entry = lru->head; entry != NULL; entry = entry->next) {
+
+        size_t bucket = Bucket(lru, entry->hash);
+
+        entry->chain = buckets[bucket];
+        buckets[bucket] = entry;
+    }
+
+    return E_OK;
+}
+
+/* ================================================================ */
+
+int sLRU_new(sLRU_t* lru, size_t capacity, void (*destroy)(void* data), size_t (*hash)(void* data), int (*match)(void* data_1, void* data_2)) {
+
+    if (lru == NULL) {
+        return E_NULL_V;
+    }
+
+    if ((hash == NULL) || (match == NULL)) {
+        return E_MISMET;
+    }
+
+    if ((*lru = calloc(1, sizeof(struct lru))) == NULL) {
+        return E_NOMEM;
+    }
+
+    if (((*lru)->buckets = calloc(LRU_BUCKETS, sizeof(struct lru_entry*))) == NULL) {
+        free(*lru);
+
+        *lru = NULL;
+
+        return E_NOMEM;
+    }
+
+    /* LRU_BUCKETS == 1 << 4 */
+    (*lru)->bits = 4;
+    (*lru)->capacity = capacity;
+
+    (*lru)->destroy = destroy;
+    (*lru)->hash = hash;
+    (*lru)->match = match;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sLRU_destroy(sLRU_t* lru) {
+
+    struct lru_entry* entry = NULL;
+    struct lru_entry* next = NULL;
+
+    if ((lru == NULL) || (*lru == NULL)) {
+        return E_NULL_V;
+    }
+
+    for (entry = (*lru)->head; entry != NULL; entry = next) {
+
+        next = entry->next;
+
+        if ((*lru)->destroy != NULL) {
+            (*lru)->destroy(entry->data);
+        }
+
+        free(entry);
+    }
+
+    free((*lru)->buckets);
+    free(*lru);
+
+    *lru = NULL;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sLRU_put(const sLRU_t lru, void* data) {
+
+    struct lru_entry** link = NULL;
+    struct lru_entry* entry = NULL;
+
+    void* evicted = NULL;
+
+    if ((lru == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    /* The data replaces the entry it matches */
+    if ((entry = Entry_find(lru, data, &link)) != NULL) {
+
+        if ((lru->destroy != NULL) && (entry->data != data)) {
+            lru->destroy(entry->data);
+        }
+
+        entry->data = data;
+
+        Entry_unlink(lru, entry);
+        Entry_push_front(lru, entry);
+
+        return E_OK;
+    }
+
+    if ((entry = malloc(sizeof(struct lru_entry))) == NULL) {
+        return E_NOMEM;
+    }
+
+    entry->hash = lru->hash(data);
+    entry->data = data;
+
+    /* `link` is the empty end of the bucket chain */
+    entry->chain = NULL;
+    *link = entry;
+
+    Entry_push_front(lru, entry);
+
+    lru->size++;
+
+    if ((lru->capacity > 0) && ((size_t) lru->size > lru->capacity)) {
+
+        Entry_remove(lru, lru->tail, &evicted);
+
+        if (lru->destroy != NULL) {
+            lru->destroy(evicted);
+        }
+    }
+
+    /* A failure to grow only makes the chains longer */
+    if ((size_t) lru->size > ((size_t) 1 << lru->bits)) {
+        Table_grow(lru);
+    }
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sLRU_get(const sLRU_t lru, void* key, void** data) {
+
+    struct lru_entry* entry = NULL;
+
+    if ((lru == NULL) || (key == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if ((entry = Entry_find(lru, key, NULL)) == NULL) {
+        return E_NOTFOUND;
+    }
+
+    if (entry != lru->head) {
+        Entry_unlink(lru, entry);
+        Entry_push_front(lru, entry);
+    }
+
+    *data = entry->data;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sLRU_touch(const sLRU_t lru, void* key) {
+
+    void* data = NULL;
+
+    return sLRU_get(lru, key, &data);
+}
+
+/* ================================ */
+
+int sLRU_remove(const sLRU_t lru, void* key, void** data) {
+
+    struct lru_entry* entry = NULL;
+
+    if ((lru == NULL) || (key == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if ((entry = Entry_find(lru, key, NULL)) == NULL) {
+        return E_NOTFOUND;
+    }
+
+    Entry_remove(lru, entry, data);
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sLRU_evict(const sLRU_t lru, void** data) {
+
+    if ((lru == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if (lru->tail == NULL) {
+        return E_NOTFOUND;
+    }
+
+    Entry_remove(lru, lru->tail, data);
+
+    return E_OK;
+}
+
+/* ================================ */
+
+ssize_t sLRU_size(const sLRU_t lru) {
+
+    if (lru == NULL) {
+        return -E_NULL_V;
+    }
+
+    return lru->size;
+}
+
+/* ================================================================ */
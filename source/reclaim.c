@@ -0,0 +1,277 @@
+#include "../include/sll.h"
+#include "../include/internal.h"
+
+#include <pthread.h>
+
+/* The `sll` tracepoints, see list.c */
+#ifdef SLL_TRACE
+    #include <sys/sdt.h>
+    #define TRACE(probe, list, size, nodes) DTRACE_PROBE3(sll, probe, (list), (size), (nodes))
+#else
+    #define TRACE(probe, list, size, nodes) ((void) (nodes))
+#endif
+
+/* ================================================================ */
+
+/* Number of nodes the background thread frees before it looks at the queue again */
+#define RECLAIM_STEP 4096
+
+/**
+ * Nodes detached from a list passed to \ref sList_destroy_async, waiting to be freed.
+ */
+struct batch {
+
+    struct batch* next;             /**< The next batch in the queue */
+
+    sNode_t head;                   /**< The next node to be freed */
+    ssize_t size;                   /**< Number of nodes left in the batch */
+
+    void (*destroy)(void* data);    /**< The `destroy` method of the list the nodes came from */
+
+    sAllocator_t allocator;         /**< The allocator of the list the nodes came from */
+};
+
+/**
+ * Batches waiting to be reclaimed, shared by \ref sList_reclaim_step and the background thread.
+ */
+static struct {
+
+    pthread_mutex_t lock;
+    pthread_cond_t pending;     /**< Signaled when a batch is queued or the thread is asked to stop */
+
+    struct batch* first;
+    struct batch* last;
+
+    pthread_t thread;
+    int running;                /**< Non-zero while the background thread is accepting work */
+} reclaimer = {PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, NULL, 0, 0};
+
+/* ================================ */
+
+/**
+ * \brief Frees up to `budget` nodes of a batch, calling its `destroy` method on their data.
+ *
+ * @param[in] batch A batch taken off the queue.
+ * @param[in] budget Maximum number of nodes to free.
+ *
+ * \return The number of nodes freed.
+ */
+static size_t Batch_free(struct batch* batch, size_t budget) {
+
+    size_t count = 0;
+
+    sNode_t node = NULL;
+
+    while ((batch->size > 0) && (count < budget)) {
+
+        node = batch->head;
+        batch->head = node->next;
+
+        /* An inline node goes away with its data, which is freed even if the list has no `destroy` method */
+        if (Node_is_inline(node)) {
+
+            if ((batch->destroy != NULL) && Allocator_is_default(&batch->allocator)) {
+                batch->destroy(node->data);
+            }
+            else {
+                Allocator_free(&batch->allocator, node->data);
+            }
+        }
+        else {
+
+            if (batch->destroy != NULL) {
+                batch->destroy(node->data);
+            }
+
+            Node_release(&batch->allocator, node);
+        }
+
+        batch->size--;
+        count++;
+    }
+
+    return count;
+}
+
+/* ================================ */
+
+/**
+ * \brief The background reclamation thread, started by \ref sList_reclaim_start.
+ *
+ * The thread sleeps until a batch is queued and frees nodes in steps of `RECLAIM_STEP`.
+ * Once asked to stop, it drains the queue before returning.
+ */
+static void* Reclaimer_run(void* arg) {
+
+    (void) arg;
+
+    for (;;) {
+
+        pthread_mutex_lock(&reclaimer.lock);
+
+        while ((reclaimer.first == NULL) && (reclaimer.running)) {
+            pthread_cond_wait(&reclaimer.pending, &reclaimer.lock);
+        }
+
+        if (reclaimer.first == NULL) {
+            pthread_mutex_unlock(&reclaimer.lock);
+
+            break ;
+        }
+
+        pthread_mutex_unlock(&reclaimer.lock);
+
+        sList_reclaim_step(RECLAIM_STEP);
+    }
+
+    return NULL;
+}
+
+/* ================================================================ */
+
+int sList_destroy_async(sList_t* list) {
+
+    struct batch* batch = NULL;
+
+    if ((list == NULL) || (*list == NULL)) {
+        return E_NULL_V;
+    }
+
+    /* Nothing to defer, data still visible to snapshot readers, sync state to tear down, or no memory to defer it with */
+    if (((*list)->data->size == 0) || ((*list)->data->snapshot != NULL) || ((*list)->data->sync != NULL) || ((batch = malloc(sizeof(struct batch))) == NULL)) {
+        return sList_destroy(list);
+    }
+
+    batch->next = NULL;
+    batch->head = (*list)->data->head;
+    batch->size = (*list)->data->size;
+    batch->destroy = (*list)->methods->destroy;
+    batch->allocator = (*list)->data->allocator;
+
+    /* The nodes are walked later, by whoever reclaims them */
+    TRACE(destroy_async, *list, 0, 0);
+
+    Iterator_forget(*list);
+
+    if ((*list)->data->bloom != NULL) {
+        Allocator_free(&batch->allocator, (*list)->data->bloom);
+    }
+
+    Allocator_free(&batch->allocator, (*list)->data);
+    Allocator_free(&batch->allocator, (*list)->methods);
+    Allocator_free(&batch->allocator, *list);
+
+    *list = NULL;
+
+    pthread_mutex_lock(&reclaimer.lock);
+
+    if (reclaimer.last == NULL) {
+        reclaimer.first = reclaimer.last = batch;
+    }
+    else {
+        reclaimer.last->next = batch;
+        reclaimer.last = batch;
+    }
+
+    pthread_cond_signal(&reclaimer.pending);
+    pthread_mutex_unlock(&reclaimer.lock);
+
+    return E_OK;
+}
+
+/* ================================ */
+
+size_t sList_reclaim_step(size_t budget) {
+
+    size_t count = 0;
+
+    struct batch* batch = NULL;
+
+    while (count < budget) {
+
+        /* Take a batch off the queue, so the lock is not held while nodes are freed */
+        pthread_mutex_lock(&reclaimer.lock);
+
+        if ((batch = reclaimer.first) != NULL) {
+
+            if ((reclaimer.first = batch->next) == NULL) {
+                reclaimer.last = NULL;
+            }
+        }
+
+        pthread_mutex_unlock(&reclaimer.lock);
+
+        if (batch == NULL) {
+            break ;
+        }
+
+        count += Batch_free(batch, budget - count);
+
+        if (batch->size == 0) {
+            free(batch);
+
+            continue ;
+        }
+
+        /* The budget is spent, put the rest back in front of the queue */
+        pthread_mutex_lock(&reclaimer.lock);
+
+        if ((batch->next = reclaimer.first) == NULL) {
+            reclaimer.last = batch;
+        }
+
+        reclaimer.first = batch;
+
+        pthread_mutex_unlock(&reclaimer.lock);
+    }
+
+    return count;
+}
+
+/* ================================ */
+
+int sList_reclaim_start(void) {
+
+    int result = E_OK;
+
+    pthread_mutex_lock(&reclaimer.lock);
+
+    if (!reclaimer.running) {
+
+        reclaimer.running = 1;
+
+        if (pthread_create(&reclaimer.thread, NULL, Reclaimer_run, NULL) != 0) {
+            reclaimer.running = 0;
+
+            result = E_NOMEM;
+        }
+    }
+
+    pthread_mutex_unlock(&reclaimer.lock);
+
+    return result;
+}
+
+/* ================================ */
+
+int sList_reclaim_stop(void) {
+
+    pthread_mutex_lock(&reclaimer.lock);
+
+    if (!reclaimer.running) {
+        pthread_mutex_unlock(&reclaimer.lock);
+
+        return E_OK;
+    }
+
+    reclaimer.running = 0;
+
+    pthread_cond_signal(&reclaimer.pending);
+    pthread_mutex_unlock(&reclaimer.lock);
+
+    pthread_join(reclaimer.thread, NULL);
+
+    return E_OK;
+}
+
+/* ================================================================ */
@@ -0,0 +1,301 @@
+#include "../include/sll.h"
+#include "../include/internal.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+/* ================================================================ */
+
+/* Number of locks guarding the published snapshot pointers; lists are spread over them by address */
+#define STRIPES 16
+
+/**
+ * An immutable copy of the data pointers a list held when it was published.
+ *
+ * Every snapshot keeps the one published after it alive, so a snapshot is freed only after all older
+ * snapshots are gone. Data retired while a snapshot is the published one is destroyed together with it:
+ * by then no reader can hold a snapshot that still refers to that data.
+ */
+struct snapshot {
+
+    _Atomic size_t refs;            /**< Readers holding the snapshot, plus the list while it is published, plus the previous snapshot */
+
+    struct snapshot* newer;         /**< The snapshot published after this one */
+
+    struct retired {
+        void* data;
+        void (*destroy)(void* data);                    /**< Destroys the data, `NULL` to release it through `release` */
+        void (*release)(void* context, void* pointer);  /**< The `free` of the allocator a copy came from */
+        void* context;
+    }* retired;                     /**< Data removed from the list while the snapshot was published */
+    size_t retired_count;
+    size_t retired_capacity;
+
+    ssize_t size;                   /**< Number of elements in the snapshot */
+    void* items[];                  /**< The list's data, in list order */
+};
+
+static pthread_mutex_t stripes[STRIPES] = {
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER,
+    PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER, PTHREAD_MUTEX_INITIALIZER
+};
+
+/* ================================ */
+
+/**
+ * \brief Returns the lock that guards the published snapshot of a given list.
+ */
+static pthread_mutex_t* Stripe(const sList_t list) {
+    return &stripes[((size_t) list >> 6) % STRIPES];
+}
+
+/* ================================ */
+
+/**
+ * \brief Drops the reference a snapshot holds on another, once the holder is freed.
+ */
+static void Snapshot_unhold(void* snapshot) {
+
+    Snapshot_drop(snapshot);
+
+    return ;
+}
+
+/* ================================================================ */
+
+void Snapshot_drop(struct snapshot* snapshot) {
+
+    struct snapshot* newer = NULL;
+
+    while ((snapshot != NULL) && (atomic_fetch_sub(&snapshot->refs, 1) == 1)) {
+
+        for (size_t i = 0; i < snapshot->retired_count; i++) {
+
+            if (snapshot->retired[i].destroy != NULL) {
+                snapshot->retired[i].destroy(snapshot->retired[i].data);
+            }
+            else if (snapshot->retired[i].release != NULL) {
+                snapshot->retired[i].release(snapshot->retired[i].context, snapshot->retired[i].data);
+            }
+        }
+
+        newer = snapshot->newer;
+
+        free(snapshot->retired);
+        free(snapshot);
+
+        /* The snapshot held a reference to the next one */
+        snapshot = newer;
+    }
+
+    return ;
+}
+
+/* ================================ */
+
+int Snapshot_retire(struct snapshot* snapshot, void* data, void (*destroy)(void* data), const sAllocator_t* allocator) {
+
+    struct retired* retired = NULL;
+
+    if (snapshot->retired_count == snapshot->retired_capacity) {
+
+        size_t capacity = (snapshot->retired_capacity > 0) ? snapshot->retired_capacity * 2 : 16;
+
+        if ((retired = realloc(snapshot->retired, capacity * sizeof(struct retired))) == NULL) {
+            return E_NOMEM;
+        }
+
+        snapshot->retired = retired;
+        snapshot->retired_capacity = capacity;
+    }
+
+    snapshot->retired[snapshot->retired_count].data = data;
+    snapshot->retired[snapshot->retired_count].destroy = destroy;
+    snapshot->retired[snapshot->retired_count].release = (allocator != NULL) ? allocator->free : NULL;
+    snapshot->retired[snapshot->retired_count].context = (allocator != NULL) ? allocator->context : NULL;
+
+    snapshot->retired_count++;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int Snapshot_inherit(const sList_t list, const sList_t out) {
+
+    struct snapshot* snapshot = NULL;
+
+    int result = E_OK;
+
+    /* No reader has ever seen the list's data */
+    if (list->data->snapshot == NULL) {
+        return E_OK;
+    }
+
+    if ((result = sList_publish(out)) != E_OK) {
+        return result;
+    }
+
+    snapshot = out->data->snapshot;
+
+    /* The list's snapshot holds the new one, like the snapshot published before it would */
+    atomic_fetch_add(&snapshot->refs, 1);
+
+    if ((result = Snapshot_retire(list->data->snapshot, snapshot, Snapshot_unhold, NULL)) != E_OK) {
+        atomic_fetch_sub(&snapshot->refs, 1);
+    }
+
+    return result;
+}
+
+/* ================================================================ */
+
+int sList_publish(const sList_t list) {
+
+    struct snapshot* snapshot = NULL;
+    struct snapshot* old = NULL;
+
+    sNode_t node = NULL;
+
+    ssize_t i = 0;
+
+    if (list == NULL) {
+        return E_NULL_V;
+    }
+
+    if ((snapshot = malloc(sizeof(struct snapshot) + list->data->size * sizeof(void*))) == NULL) {
+        return E_NOMEM;
+    }
+
+    atomic_init(&snapshot->refs, 1);
+
+    snapshot->newer = NULL;
+    snapshot->retired = NULL;
+    snapshot->retired_count = snapshot->retired_capacity = 0;
+    snapshot->size = list->data->size;
+
+    for (node = list->data->head; node != NULL; node = node->next) {
+        snapshot->items[i++] = node->data;
+    }
+
+    pthread_mutex_lock(Stripe(list));
+
+    if ((old = list->data->snapshot) != NULL) {
+        old->newer = snapshot;
+        atomic_fetch_add(&snapshot->refs, 1);
+    }
+
+    list->data->snapshot = snapshot;
+
+    pthread_mutex_unlock(Stripe(list));
+
+    /* The list no longer holds the previous snapshot */
+    Snapshot_drop(old);
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sList_retire(const sList_t list, void* data) {
+
+    if ((list == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if (list->methods->destroy == NULL) {
+        return E_OK;
+    }
+
+    /* No reader has ever seen the list's data */
+    if (list->data->snapshot == NULL) {
+        list->methods->destroy(data);
+
+        return E_OK;
+    }
+
+    return Snapshot_retire(list->data->snapshot, data, list->methods->destroy, NULL);
+}
+
+/* ================================ */
+
+int sList_snapshot(const sList_t list, sSnapshot_t* snapshot) {
+
+    if ((list == NULL) || (snapshot == NULL)) {
+        return E_NULL_V;
+    }
+
+    pthread_mutex_lock(Stripe(list));
+
+    if ((*snapshot = list->data->snapshot) != NULL) {
+        atomic_fetch_add(&(*snapshot)->refs, 1);
+    }
+
+    pthread_mutex_unlock(Stripe(list));
+
+    return (*snapshot != NULL) ? E_OK : E_NULL_V;
+}
+
+/* ================================ */
+
+int sSnapshot_release(sSnapshot_t* snapshot) {
+
+    if ((snapshot == NULL) || (*snapshot == NULL)) {
+        return E_NULL_V;
+    }
+
+    Snapshot_drop(*snapshot);
+
+    *snapshot = NULL;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+ssize_t sSnapshot_size(const sSnapshot_t snapshot) {
+
+    if (snapshot == NULL) {
+        return -E_NULL_V;
+    }
+
+    return snapshot->size;
+}
+
+/* ================================ */
+
+int sSnapshot_at(const sSnapshot_t snapshot, size_t index, void** data) {
+
+    if ((snapshot == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if (index >= (size_t) snapshot->size) {
+        return E_NULL_V;
+    }
+
+    *data = snapshot->items[index];
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sSnapshot_foreach(const sSnapshot_t snapshot, int (*func)(void* data)) {
+
+    int result = E_OK;
+
+    if ((snapshot == NULL) || (func == NULL)) {
+        return E_NULL_V;
+    }
+
+    for (ssize_t i = 0; i < snapshot->size; i++) {
+        result += func(snapshot->items[i]);
+    }
+
+    return result;
+}
+
+/* ================================================================ */
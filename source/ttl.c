@@ -0,0 +1,393 @@
+#include "../include/sll.h"
+
+/* ================================================================ */
+
+/* A wheel has `LEVELS` levels of `SLOTS` slots; a slot of level `l` spans `SLOTS^l` ticks */
+#define LEVELS 4
+#define SLOT_BITS 6
+#define SLOTS (1 << SLOT_BITS)
+#define SLOT_MASK (SLOTS - 1)
+
+/* Deadlines further away than this are parked in the last slot the wheel reaches and placed again when it comes up */
+#define SPAN ((uint64_t) 1 << (LEVELS * SLOT_BITS))
+
+/**
+ * An element of an expiry container, linked into the slot its deadline falls in.
+ */
+struct timer {
+
+    struct timer* prev;
+    struct timer* next;
+
+    uint64_t deadline;
+
+    uint8_t level;
+    uint8_t slot;
+
+    void* data;
+};
+
+/**
+ * A hierarchical timer wheel.
+ */
+struct ttl {
+
+    struct timer* slots[LEVELS][SLOTS];
+    uint64_t occupied[LEVELS];      /**< Bit `i` is set if slot `i` of the level is not empty */
+
+    uint64_t now;                   /**< The last tick processed */
+
+    ssize_t size;                   /**< Number of elements in the container */
+
+    void (*destroy)(void* data);    /**< See the \ref methods struct */
+    void (*expire)(void* data);     /**< Called on expired data, `destroy` if `NULL` */
+};
+
+/* ================================ */
+
+/**
+ * \brief Links a timer into the slot its deadline falls in, as seen from `base`, the first tick not yet processed.
+ *
+ * The lowest level takes deadlines less than `SLOTS` ticks away, each higher level deadlines `SLOTS` times further.
+ * Deadlines before `base` go to its slot.
+ */
+static void Timer_place(const sTTL_t ttl, struct timer* timer, uint64_t base) {
+
+    uint64_t deadline = timer->deadline;
+    uint8_t level = 0;
+
+    if (deadline < base) {
+        deadline = base;
+    }
+    else if (deadline - base >= SPAN) {
+        deadline = base + SPAN - 1;
+    }
+
+    while ((level < LEVELS - 1) && ((deadline - base) >> ((level + 1) * SLOT_BITS)) != 0) {
+        level++;
+    }
+
+    timer->level = level;
+    timer->slot = (deadline >> (level * SLOT_BITS)) & SLOT_MASK;
+
+    timer->prev = NULL;
+
+    if ((timer->next = ttl->slots[level][timer->slot]) != NULL) {
+        timer->next->prev = timer;
+    }
+
+    ttl->slots[level][timer->slot] = timer;
+    ttl->occupied[level] |= (uint64_t) 1 << timer->slot;
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * \brief Unlinks a timer from its slot.
+ */
+static void Timer_unlink(const sTTL_t ttl, struct timer* timer) {
+
+    if (timer->prev != NULL) {
+        timer->prev->next = timer->next;
+    }
+    else {
+        ttl->slots[timer->level][timer->slot] = timer->next;
+    }
+
+    if (timer->next != NULL) {
+        timer->next->prev = timer->prev;
+    }
+
+    if (ttl->slots[timer->level][timer->slot] == NULL) {
+        ttl->occupied[timer->level] &= ~((uint64_t) 1 << timer->slot);
+    }
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * \brief Takes all timers out of a slot.
+ *
+ * \return The first timer of the slot; the others follow through `next`.
+ */
+static struct timer* Slot_take(const sTTL_t ttl, unsigned int level, unsigned int slot) {
+
+    struct timer* first = ttl->slots[level][slot];
+
+    ttl->slots[level][slot] = NULL;
+    ttl->occupied[level] &= ~((uint64_t) 1 << slot);
+
+    return first;
+}
+
+/* ================================ */
+
+/**
+ * \brief Moves the timers of the higher-level slots that come up at tick `tick`, a multiple of `SLOTS`, to lower levels.
+ */
+static void Wheel_cascade(const sTTL_t ttl, uint64_t tick) {
+
+    struct timer* timer = NULL;
+    struct timer* next = NULL;
+
+    for (unsigned int level = 1; level < LEVELS; level++) {
+
+        unsigned int slot = (tick >> (level * SLOT_BITS)) & SLOT_MASK;
+
+        for (timer = Slot_take(ttl, level, slot); timer != NULL; timer = next) {
+            next = timer->next;
+
+            Timer_place(ttl, timer, tick);
+        }
+
+        /* The next level only comes up when this one wraps around */
+        if (slot != 0) {
+            break ;
+        }
+    }
+
+    return ;
+}
+
+/* ================================ */
+
+/**
+ * \brief Finds the first tick from `tick` on at which a higher-level slot holding timers comes up.
+ *
+ * A slot of level `l` comes up at the multiples of `SLOTS^l` whose level-`l` digit is the slot's index, so the next
+ * one is found from the level's bitmap, starting at the first such multiple not before `tick`.
+ *
+ * \return The tick, `UINT64_MAX` if the higher levels are empty.
+ */
+static uint64_t Wheel_next_cascade(const sTTL_t ttl, uint64_t tick) {
+
+    uint64_t next = UINT64_MAX;
+
+    for (unsigned int level = 1; level < LEVELS; level++) {
+
+        unsigned int shift = level * SLOT_BITS;
+        uint64_t occupied = ttl->occupied[level];
+
+        if (occupied == 0) {
+            continue ;
+        }
+
+        /* The first time the level moves on to another slot, from `tick` on, and the slot it moves to */
+        uint64_t turn = (tick + ((uint64_t) 1 << shift) - 1) >> shift;
+        unsigned int slot = turn & SLOT_MASK;
+
+        /* The occupied slots, counted from that one */
+        occupied = (occupied >> slot) | (occupied << ((SLOTS - slot) & SLOT_MASK));
+
+        if (((turn + (uint64_t) __builtin_ctzll(occupied)) << shift) < next) {
+            next = (turn + (uint64_t) __builtin_ctzll(occupied)) << shift;
+        }
+    }
+
+    return next;
+}
+
+/* ================================================================ */
+
+int sTTL_new(sTTL_t* ttl, uint64_t now, void (*destroy)(void* data), void (*expire)(void* data)) {
+
+    if (ttl == NULL) {
+        return E_NULL_V;
+    }
+
+    if ((*ttl = calloc(1, sizeof(struct ttl))) == NULL) {
+        return E_NOMEM;
+    }
+
+    (*ttl)->now = now;
+
+    (*ttl)->destroy = destroy;
+    (*ttl)->expire = expire;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sTTL_destroy(sTTL_t* ttl) {
+
+    struct timer* timer = NULL;
+    struct timer* next = NULL;
+
+    if ((ttl == NULL) || (*ttl == NULL)) {
+        return E_NULL_V;
+    }
+
+    for (unsigned int level = 0; level < LEVELS; level++) {
+
+        for (unsigned int slot = 0; slot < SLOTS; slot++) {
+
+            for (timer = (*ttl)->slots[level][slot]; timer != NULL; timer = next) {
+                next = timer->next;
+
+                if ((*ttl)->destroy != NULL) {
+                    (*ttl)->destroy(timer->data);
+                }
+
+                free(timer);
+            }
+        }
+    }
+
+    free(*ttl);
+
+    *ttl = NULL;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sTTL_insert(const sTTL_t ttl, void* data, uint64_t deadline, sTimer_t* timer) {
+
+    struct timer* t = NULL;
+
+    if ((ttl == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if ((t = malloc(sizeof(struct timer))) == NULL) {
+        return E_NOMEM;
+    }
+
+    t->deadline = deadline;
+    t->data = data;
+
+    Timer_place(ttl, t, ttl->now + 1);
+
+    ttl->size++;
+
+    if (timer != NULL) {
+        *timer = t;
+    }
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sTTL_refresh(const sTTL_t ttl, sTimer_t timer, uint64_t deadline) {
+
+    if ((ttl == NULL) || (timer == NULL)) {
+        return E_NULL_V;
+    }
+
+    Timer_unlink(ttl, timer);
+
+    timer->deadline = deadline;
+
+    Timer_place(ttl, timer, ttl->now + 1);
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sTTL_cancel(const sTTL_t ttl, sTimer_t timer, void** data) {
+
+    if ((ttl == NULL) || (timer == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    Timer_unlink(ttl, timer);
+
+    *data = timer->data;
+
+    free(timer);
+
+    ttl->size--;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+ssize_t sTTL_expire(const sTTL_t ttl, uint64_t now) {
+
+    struct timer* timer = NULL;
+    struct timer* next = NULL;
+
+    void (*expire)(void* data) = NULL;
+
+    ssize_t count = 0;
+
+    if (ttl == NULL) {
+        return -E_NULL_V;
+    }
+
+    expire = (ttl->expire != NULL) ? ttl->expire : ttl->destroy;
+
+    while (ttl->now < now) {
+
+        uint64_t tick = ttl->now + 1;
+        uint64_t pending = 0;
+
+        if (ttl->size == 0) {
+            ttl->now = now;
+
+            break ;
+        }
+
+        if ((tick & SLOT_MASK) == 0) {
+            Wheel_cascade(ttl, tick);
+        }
+
+        /*
+         * Skip to the next occupied slot of the lowest level. If there is none in this turn, skip to the next turn
+         * if the lowest level holds timers for it, or else straight to the next cascade, so the time it takes does
+         * not grow with the ticks skipped.
+         */
+        if ((pending = ttl->occupied[0] >> (tick & SLOT_MASK)) == 0) {
+            uint64_t next = (ttl->occupied[0] != 0) ? (tick | SLOT_MASK) + 1 : Wheel_next_cascade(ttl, tick + 1);
+
+            ttl->now = (next <= now) ? next - 1 : now;
+
+            continue ;
+        }
+
+        if ((tick += (uint64_t) __builtin_ctzll(pending)) > now) {
+            ttl->now = now;
+
+            break ;
+        }
+
+        ttl->now = tick;
+
+        for (timer = Slot_take(ttl, 0, tick & SLOT_MASK); timer != NULL; timer = next) {
+            next = timer->next;
+
+            if (expire != NULL) {
+                expire(timer->data);
+            }
+
+            free(timer);
+
+            ttl->size--;
+            count++;
+        }
+    }
+
+    return count;
+}
+
+/* ================================ */
+
+ssize_t sTTL_size(const sTTL_t ttl) {
+
+    if (ttl == NULL) {
+        return -E_NULL_V;
+    }
+
+    return ttl->size;
+}
+
+/* ================================================================ */
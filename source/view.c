@@ -0,0 +1,196 @@
+#include "../include/sll.h"
+#include "../include/internal.h"
+
+/* ================================================================ */
+
+/**
+ * \brief Sets up a view of `length` elements starting at a given node.
+ */
+static void View_init(sView_t* view, const sList_t list, const sNode_t first, size_t length) {
+
+    view->list = list;
+    view->first = (length > 0) ? first : NULL;
+    view->length = length;
+
+    view->cursor = view->first;
+    view->position = 0;
+
+    return ;
+}
+
+/* ================================================================ */
+
+int sList_view(const sList_t list, size_t index, size_t length, sView_t* view) {
+
+    size_t size = 0;
+
+    if ((list == NULL) || (view == NULL)) {
+        return E_NULL_V;
+    }
+
+    size = (size_t) list->data->size;
+
+    if (index > size) {
+        return E_NOTFOUND;
+    }
+
+    if (length > size - index) {
+        length = size - index;
+    }
+
+    View_init(view, list, (length > 0) ? Node_at(list, (ssize_t) index, NULL) : NULL, length);
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sList_view_range(const sList_t list, const sNode_t first, const sNode_t last, sView_t* view) {
+
+    sNode_t node = NULL;
+    sNode_t end = NULL;
+
+    size_t length = 1;
+
+    if ((list == NULL) || (first == NULL) || (view == NULL)) {
+        return E_NULL_V;
+    }
+
+    end = (last != NULL) ? last : list->data->tail;
+
+    if ((Node_list(first) != list) || (Node_list(end) != list)) {
+        return E_MATCH;
+    }
+
+    for (node = first; (node != NULL) && (node != end); node = node->next) {
+        length++;
+    }
+
+    if (node == NULL) {
+        return E_MATCH;
+    }
+
+    View_init(view, list, first, length);
+
+    return E_OK;
+}
+
+/* ================================ */
+
+ssize_t sView_size(const sView_t* view) {
+
+    if (view == NULL) {
+        return -E_NULL_V;
+    }
+
+    return (ssize_t) view->length;
+}
+
+/* ================================ */
+
+int sView_foreach(const sView_t* view, int (*func)(void* data)) {
+
+    int result = E_OK;
+
+    sNode_t node = NULL;
+
+    if ((view == NULL) || (func == NULL)) {
+        return E_NULL_V;
+    }
+
+    node = view->first;
+
+    for (size_t i = 0; i < view->length; i++, node = node->next) {
+        result += func(node->data);
+    }
+
+    return result;
+}
+
+/* ================================ */
+
+int sView_find(const sView_t* view, void* data, sNode_t* node) {
+
+    sNode_t temp = NULL;
+
+    if ((view == NULL) || (data == NULL) || (node == NULL)) {
+        return E_NULL_V;
+    }
+
+    if (view->list->methods->match == NULL) {
+        return E_MISMET;
+    }
+
+    temp = view->first;
+
+    for (size_t i = 0; i < view->length; i++, temp = temp->next) {
+
+        if (view->list->methods->match(temp->data, data) == 0) {
+            *node = temp;
+
+            return E_OK;
+        }
+    }
+
+    return E_NOTFOUND;
+}
+
+/* ================================ */
+
+int sView_next(sView_t* view, void** data) {
+
+    if ((view == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if (view->position == view->length) {
+        view->cursor = view->first;
+        view->position = 0;
+
+        return E_NOTFOUND;
+    }
+
+    *data = view->cursor->data;
+
+    view->cursor = view->cursor->next;
+    view->position++;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sView_split(const sView_t* view, size_t parts, sView_t* views) {
+
+    sView_t whole;
+    sNode_t node = NULL;
+
+    size_t length = 0;
+
+    if ((view == NULL) || (views == NULL)) {
+        return E_NULL_V;
+    }
+
+    if (parts == 0) {
+        return E_INVAL;
+    }
+
+    /* The view may be one of the parts being set up */
+    whole = *view;
+    node = whole.first;
+
+    for (size_t i = 0; i < parts; i++) {
+
+        length = whole.length / parts + (i < whole.length % parts);
+
+        View_init(&views[i], whole.list, node, length);
+
+        for (size_t j = 0; j < length; j++) {
+            node = node->next;
+        }
+    }
+
+    return E_OK;
+}
+
+/* ================================================================ */
@@ -0,0 +1,366 @@
+#include "../include/sll.h"
+
+#include <stdatomic.h>
+
+/* ================================================================ */
+
+/* Number of slots a deque starts with, always a power of two */
+#define DEQUE_SLOTS 64
+
+/* Deques are kept on separate cache lines, so workers do not invalidate each other's */
+#define CACHE_LINE 64
+
+/**
+ * The circular array holding the items of a deque. When it fills up, the owner copies the items into one
+ * twice as large; the old array is kept until the container is destroyed, since thieves may still read from it.
+ * As every array is twice the size of the one it replaced, the old ones together are smaller than the current one:
+ * a deque never holds more than twice the memory its largest array needs.
+ */
+struct ring {
+
+    struct ring* older;             /**< The array this one replaced */
+
+    size_t mask;                    /**< The number of slots minus one */
+
+    _Atomic(void*) items[];
+};
+
+/**
+ * A Chase–Lev deque. The owner works at the bottom, thieves take from the top.
+ */
+struct deque {
+
+    _Alignas(CACHE_LINE) _Atomic int64_t top;     /**< The next item to be stolen */
+    _Atomic int64_t bottom;                        /**< The slot the next item is pushed into */
+
+    _Atomic(struct ring*) ring;
+};
+
+/**
+ * A work container: one deque per worker.
+ */
+struct work {
+
+    struct deque* deques;
+    size_t workers;
+
+    void (*destroy)(void* data);    /**< See the \ref methods struct */
+};
+
+/* ================================ */
+
+/**
+ * \brief Creates a ring of a given number of slots, a power of two.
+ */
+static struct ring* Ring_new(size_t slots, struct ring* older) {
+
+    struct ring* ring = NULL;
+
+    if ((ring = malloc(sizeof(struct ring) + slots * sizeof(_Atomic(void*)))) == NULL) {
+        return NULL;
+    }
+
+    ring->older = older;
+    ring->mask = slots - 1;
+
+    return ring;
+}
+
+/* ================================ */
+
+/**
+ * \brief Replaces the ring of a deque with one twice as large. Only the owner calls this.
+ *
+ * \return The new ring, or `NULL` if there is no memory for it.
+ */
+static struct ring* Ring_grow(struct deque* deque, struct ring* ring, int64_t top, int64_t bottom) {
+
+    struct ring* grown = NULL;
+
+    if ((grown = Ring_new(2 * (ring->mask + 1), ring)) == NULL) {
+        return NULL;
+    }
+
+    for (int64_t i = top; i < bottom; i++) {
+        atomic_store_explicit(&grown->items[i & grown->mask], atomic_load_explicit(&ring->items[i & ring->mask], memory_order_relaxed), memory_order_relaxed);
+    }
+
+    atomic_store_explicit(&deque->ring, grown, memory_order_release);
+
+    return grown;
+}
+
+/* ================================ */
+
+/**
+ * \brief Takes the top item of a deque.
+ *
+ * \return 0 on success, `E_NOTFOUND` if the deque is empty, or -1 if another thread took the item first.
+ */
+static int Deque_steal(struct deque* deque, void** data) {
+
+    /* Sequentially consistent, so `top` is read before `bottom`, as the owner's pop expects */
+    int64_t top = atomic_load_explicit(&deque->top, memory_order_seq_cst);
+    int64_t bottom = atomic_load_explicit(&deque->bottom, memory_order_seq_cst);
+
+    struct ring* ring = NULL;
+
+    void* item = NULL;
+
+    if (top >= bottom) {
+        return E_NOTFOUND;
+    }
+
+    ring = atomic_load_explicit(&deque->ring, memory_order_acquire);
+    item = atomic_load_explicit(&ring->items[top & ring->mask], memory_order_relaxed);
+
+    if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed)) {
+        return -1;
+    }
+
+    *data = item;
+
+    return E_OK;
+}
+
+/* ================================================================ */
+
+int sWork_new(sWork_t* work, size_t workers, void (*destroy)(void* data)) {
+
+    struct ring* ring = NULL;
+
+    if (work == NULL) {
+        return E_NULL_V;
+    }
+
+    if (workers == 0) {
+        return E_INVAL;
+    }
+
+    if ((*work = malloc(sizeof(struct work))) == NULL) {
+        return E_NOMEM;
+    }
+
+    if (((*work)->deques = aligned_alloc(CACHE_LINE, workers * sizeof(struct deque))) == NULL) {
+        free(*work);
+
+        *work = NULL;
+
+        return E_NOMEM;
+    }
+
+    (*work)->workers = workers;
+    (*work)->destroy = destroy;
+
+    for (size_t i = 0; i < workers; i++) {
+
+        atomic_init(&(*work)->deques[i].top, 0);
+        atomic_init(&(*work)->deques[i].bottom, 0);
+
+        ring = Ring_new(DEQUE_SLOTS, NULL);
+
+        atomic_init(&(*work)->deques[i].ring, ring);
+
+        if (ring == NULL) {
+            (*work)->workers = i + 1;
+
+            sWork_destroy(work);
+
+            return E_NOMEM;
+        }
+    }
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sWork_destroy(sWork_t* work) {
+
+    struct ring* ring = NULL;
+    struct ring* older = NULL;
+
+    if ((work == NULL) || (*work == NULL)) {
+        return E_NULL_V;
+    }
+
+    for (size_t i = 0; i < (*work)->workers; i++) {
+
+        struct deque* deque = &(*work)->deques[i];
+
+        if ((ring = atomic_load(&deque->ring)) == NULL) {
+            continue ;
+        }
+
+        if ((*work)->destroy != NULL) {
+
+            for (int64_t j = atomic_load(&deque->top); j < atomic_load(&deque->bottom); j++) {
+                (*work)->destroy(atomic_load_explicit(&ring->items[j & ring->mask], memory_order_relaxed));
+            }
+        }
+
+        for (; ring != NULL; ring = older) {
+            older = ring->older;
+
+            free(ring);
+        }
+    }
+
+    free((*work)->deques);
+    free(*work);
+
+    *work = NULL;
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sWork_push(const sWork_t work, size_t worker, void* data) {
+
+    struct deque* deque = NULL;
+    struct ring* ring = NULL;
+
+    int64_t top = 0;
+    int64_t bottom = 0;
+
+    if ((work == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if (worker >= work->workers) {
+        return E_INVAL;
+    }
+
+    deque = &work->deques[worker];
+
+    bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed);
+    top = atomic_load_explicit(&deque->top, memory_order_acquire);
+    ring = atomic_load_explicit(&deque->ring, memory_order_relaxed);
+
+    if ((bottom - top > (int64_t) ring->mask) && ((ring = Ring_grow(deque, ring, top, bottom)) == NULL)) {
+        return E_NOMEM;
+    }
+
+    atomic_store_explicit(&ring->items[bottom & ring->mask], data, memory_order_relaxed);
+
+    /* The item must be visible before thieves can see the new bottom */
+    atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_release);
+
+    return E_OK;
+}
+
+/* ================================ */
+
+int sWork_pop(const sWork_t work, size_t worker, void** data) {
+
+    struct deque* deque = NULL;
+    struct ring* ring = NULL;
+
+    int64_t top = 0;
+    int64_t bottom = 0;
+
+    void* item = NULL;
+
+    int result = E_OK;
+
+    if ((work == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    if (worker >= work->workers) {
+        return E_INVAL;
+    }
+
+    deque = &work->deques[worker];
+
+    /* Claim the bottom item first, then see whether a thief got to it */
+    bottom = atomic_load_explicit(&deque->bottom, memory_order_relaxed) - 1;
+    ring = atomic_load_explicit(&deque->ring, memory_order_relaxed);
+
+    /* Sequentially consistent, so a thief reading `top` after this store sees the claim; unlike a fence, ThreadSanitizer follows it */
+    atomic_store_explicit(&deque->bottom, bottom, memory_order_seq_cst);
+
+    top = atomic_load_explicit(&deque->top, memory_order_seq_cst);
+
+    if (top > bottom) {
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+
+        return E_NOTFOUND;
+    }
+
+    item = atomic_load_explicit(&ring->items[bottom & ring->mask], memory_order_relaxed);
+
+    /* The last item: the owner and the thieves race for it on `top` */
+    if (top == bottom) {
+
+        if (!atomic_compare_exchange_strong_explicit(&deque->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed)) {
+            result = E_NOTFOUND;
+        }
+
+        atomic_store_explicit(&deque->bottom, bottom + 1, memory_order_relaxed);
+    }
+
+    if (result == E_OK) {
+        *data = item;
+    }
+
+    return result;
+}
+
+/* ================================ */
+
+int sWork_steal(const sWork_t work, size_t worker, void** data) {
+
+    int result = E_NOTFOUND;
+    int contended = 0;
+
+    if ((work == NULL) || (data == NULL)) {
+        return E_NULL_V;
+    }
+
+    /* A lost race means the victim had work, so another round is worth it; a round of empty deques is not */
+    do {
+        contended = 0;
+
+        for (size_t i = 1; i <= work->workers; i++) {
+
+            size_t victim = (worker + i) % work->workers;
+
+            if (victim == worker) {
+                continue ;
+            }
+
+            if ((result = Deque_steal(&work->deques[victim], data)) == E_OK) {
+                return E_OK;
+            }
+
+            contended |= (result == -1);
+        }
+    } while (contended);
+
+    return E_NOTFOUND;
+}
+
+/* ================================ */
+
+ssize_t sWork_size(const sWork_t work) {
+
+    ssize_t size = 0;
+
+    if (work == NULL) {
+        return -E_NULL_V;
+    }
+
+    for (size_t i = 0; i < work->workers; i++) {
+
+        int64_t count = atomic_load(&work->deques[i].bottom) - atomic_load(&work->deques[i].top);
+
+        /* A pop in progress briefly makes the count negative */
+        size += (count > 0) ? (ssize_t) count : 0;
+    }
+
+    return size;
+}
+
+/* ================================================================ */
@@ -0,0 +1,137 @@
+#include "../include/sll.h"
+
+#include <time.h>
+
+/* Number of elements; the default list occupies well over 1 GiB, which is larger than any LLC */
+#define SIZE (1 << 24)
+
+#define ROUNDS 5
+
+static long long sum = 0;
+
+int add(void* data) {
+
+    sum += *((int*) data);
+
+    return 1;
+}
+
+int match_int(void* data_1, void* data_2) {
+
+    if ((data_1 == NULL) || (data_2 == NULL)) {
+        return -1;
+    }
+
+    return !(*((int*) data_1) == *((int*) data_2));
+}
+
+double elapsed(struct timespec* start, struct timespec* end) {
+    return (end->tv_sec - start->tv_sec) * 1e9 + (end->tv_nsec - start->tv_nsec);
+}
+
+/* ================================================================ */
+
+int main(int argc, char** argv) {
+
+    size_t size = (argc > 1) ? strtoull(argv[1], NULL, 10) : SIZE;
+
+    struct timespec start, end;
+
+    sList_t list = NULL;
+
+    /* Padding blocks of random size keep nodes and data scattered, so the hardware prefetcher cannot follow them */
+    void** padding = calloc(size, sizeof(void*));
+
+    if ((padding == NULL) || (sList_new(&list, free, NULL, match_int) != E_OK)) {
+        return EXIT_FAILURE;
+    }
+
+    srand(1);
+
+    for (size_t i = 0; i < size; i++) {
+
+        int* value = malloc(sizeof(int));
+
+        *value = (int) i;
+
+        padding[i] = malloc(16 + (rand() % 8) * 64);
+
+        if (sList_insert_last(list, value) != E_OK) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        free(padding[i]);
+    }
+
+    free(padding);
+
+    int missing = -1;
+    sNode_t node = NULL;
+
+    double foreach_ns = 0;
+    double find_ns = 0;
+
+    for (size_t r = 0; r < ROUNDS; r++) {
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        sList_foreach(list, add);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        foreach_ns += elapsed(&start, &end);
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        sList_find(list, &missing, &node);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        find_ns += elapsed(&start, &end);
+    }
+
+    printf("%s: %zu elements, sList_foreach %.2f ns/node, sList_find (miss) %.2f ns/node (checksum %lld)\n",
+#ifdef SLL_NO_PREFETCH
+        "no prefetch",
+#else
+        "prefetch",
+#endif
+        size, foreach_ns / (ROUNDS * size), find_ns / (ROUNDS * size), sum);
+
+    /* The same lookup on a keyed list, which compares keys a chunk at a time without calling `match` */
+    sKList_t keyed = NULL;
+    void* data = NULL;
+
+    double keyed_ns = 0;
+
+    if (sKList_new(&keyed, NULL) != E_OK) {
+        return EXIT_FAILURE;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+
+        if (sKList_insert_last(keyed, (uint32_t) i, &missing) != E_OK) {
+            return EXIT_FAILURE;
+        }
+    }
+
+    for (size_t r = 0; r < ROUNDS; r++) {
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        sKList_find(keyed, (uint32_t) missing, &data);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        keyed_ns += elapsed(&start, &end);
+    }
+
+    printf("%s: sKList_find (miss) %.2f ns/element\n",
+#ifdef SLL_NO_SIMD
+        "scalar",
+#else
+        "simd",
+#endif
+        keyed_ns / (ROUNDS * size));
+
+    sKList_destroy(&keyed);
+    sList_destroy(&list);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,228 @@
+#include "../include/sll.h"
+
+#include <stdint.h>
+#include <assert.h>
+
+/*
+ * Drives random sequences of compact list operations and checks the list against the model, which holds the
+ * same data in the same order. Handles to removed nodes are kept and checked to stay stale while their slots
+ * are reused, and every run also checks that handles to another list's nodes are rejected.
+ */
+
+/* The longest list a run builds, and the number of stale handles kept */
+#define CAPACITY 128
+#define STALE 64
+
+#define MODEL_CAPACITY CAPACITY
+
+#include "model.h"
+
+static sCNode_t stale[STALE];
+static size_t stale_count;
+
+/* ================================================================ */
+
+int match_int(void* data_1, void* data_2) {
+    return !(*((int*) data_1) == *((int*) data_2));
+}
+
+/* Looks up the handle of the element at a given position */
+sCNode_t Handle_of(const sCList_t list, size_t index) {
+
+    sCNode_t node;
+    void* data = NULL;
+
+    assert(sCList_find(list, model.items[index], &node) == E_OK);
+    assert((sCList_get(list, node, &data) == E_OK) && (data == model.items[index]));
+
+    return node;
+}
+
+/* Removes the element at a given position with its handle, which is then kept to check it goes stale */
+void Remove(const sCList_t list, size_t index) {
+
+    void* data = NULL;
+    sCNode_t node = Handle_of(list, index);
+
+    assert(sCList_delete_Node(list, node, &data) == E_OK);
+    assert(data == Model_remove(index));
+
+    stale[stale_count++ % STALE] = node;
+
+    free(data);
+
+    return ;
+}
+
+void Model_check(const sCList_t list) {
+
+    void* data = NULL;
+    int value = 0;
+
+    assert(sCList_size(list) == (ssize_t) model.size);
+
+    seen_count = 0;
+
+    assert(sCList_foreach(list, collect) == (int) model.size);
+
+    Model_check_seen();
+
+    /* Slots are reused, handles to their old nodes are not */
+    for (size_t i = 0; (i < stale_count) && (i < STALE); i++) {
+        assert(sCList_get(list, stale[i], &data) == E_MATCH);
+        assert(sCList_insert_after(list, stale[i], &value) == E_MATCH);
+        assert(sCNode_belongs(stale[i], list) == 1);
+    }
+
+    return ;
+}
+
+/* ================================================================ */
+
+void Run(const sCList_t list, const sCList_t other, size_t steps) {
+
+    void* data = NULL;
+
+    int counter = 0;
+    int missing = -1;
+
+    sCNode_t node;
+
+    for (size_t s = 0; s < steps; s++) {
+
+        size_t index = (model.size > 0) ? rand() % model.size : 0;
+        int operation = rand() % 8;
+
+        if ((model.size == CAPACITY) && (operation < 3)) {
+            operation = 3;
+        }
+
+        switch (operation) {
+
+            case 0: {
+                int* value = Value_new(&counter);
+
+                assert(sCList_insert_first(list, value) == E_OK);
+                Model_insert(0, value);
+
+                break ;
+            }
+
+            case 1: {
+                int* value = Value_new(&counter);
+
+                assert(sCList_insert_last(list, value) == E_OK);
+                Model_insert(model.size, value);
+
+                break ;
+            }
+
+            case 2: {
+                if (model.size == 0) {
+                    break ;
+                }
+
+                int* value = Value_new(&counter);
+
+                assert(sCList_insert_after(list, Handle_of(list, index), value) == E_OK);
+                Model_insert(index + 1, value);
+
+                break ;
+            }
+
+            case 3:
+                if (model.size == 0) {
+                    assert(sCList_remove_first(list, &data) == E_NOTFOUND);
+
+                    break ;
+                }
+
+                assert(sCList_remove_first(list, &data) == E_OK);
+                assert(data == Model_remove(0));
+
+                free(data);
+
+                break ;
+
+            case 4:
+                if (model.size == 0) {
+                    assert(sCList_remove_last(list, &data) == E_NOTFOUND);
+
+                    break ;
+                }
+
+                assert(sCList_remove_last(list, &data) == E_OK);
+                assert(data == Model_remove(model.size - 1));
+
+                free(data);
+
+                break ;
+
+            case 5:
+            case 6:
+                if (model.size > 0) {
+                    Remove(list, index);
+                }
+
+                break ;
+
+            case 7:
+                assert(sCList_find(list, &missing, &node) == E_NOTFOUND);
+
+                /* The other list's nodes sit in slots with the same indices and generations */
+                assert(sCList_find(other, &missing, &node) == E_OK);
+                assert(sCList_get(list, node, &data) == E_MATCH);
+                assert(sCList_delete_Node(list, node, &data) == E_MATCH);
+                assert((sCNode_belongs(node, list) == 1) && (sCNode_belongs(node, other) == 0));
+
+                break ;
+        }
+
+        Model_check(list);
+    }
+
+    while (model.size > 0) {
+        Remove(list, 0);
+    }
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(int argc, char** argv) {
+
+    sCList_t list = NULL;
+    sCList_t other = NULL;
+
+    int missing = -1;
+
+    unsigned int seed = 0;
+    size_t runs = Model_runs(argc, argv, 1000, &seed);
+
+    for (size_t r = 0; r < runs; r++) {
+
+        Model_reset();
+        stale_count = 0;
+
+        /* A small pool grows while the run goes */
+        assert(sCList_new(&list, 1 + rand() % 8, free, match_int) == E_OK);
+        assert(sCList_new(&other, 0, NULL, match_int) == E_OK);
+        assert(sCList_insert_last(other, &missing) == E_OK);
+
+        Run(list, other, rand() % 512);
+
+        Model_check(list);
+
+        /* Destroying the list destroys what is left in it */
+        assert(sCList_insert_last(list, Value_new(&(int) {0})) == E_OK);
+
+        assert(sCList_destroy(&list) == E_OK);
+        assert(sCList_destroy(&other) == E_OK);
+        assert((list == NULL) && (other == NULL));
+    }
+
+    printf("%zu runs passed (seed %u)\n", runs, seed);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,335 @@
+#include "../include/coro.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+/*
+ * Checks the coroutine layer over lists in sync mode: coroutines that pop before anything is pushed, waiters
+ * resumed in the order they started waiting, `dispatch` after C producers, `serve` on a `std::jthread` next to
+ * other threads pushing, `close`, and streams ending when their queue is closed.
+ *
+ * Built with `g++ -std=c++20` under AddressSanitizer and UndefinedBehaviorSanitizer (`make coro`).
+ */
+
+/* Waiters and elements of the threaded cases */
+#define ITEMS 5000
+
+/**
+ * A coroutine that starts right away and cleans up after itself when it returns.
+ */
+struct task {
+
+    struct promise_type {
+
+        task get_return_object() noexcept {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() const noexcept {
+            return {};
+        }
+
+        std::suspend_never final_suspend() const noexcept {
+            return {};
+        }
+
+        void return_void() noexcept {}
+
+        void unhandled_exception() noexcept {
+            std::terminate();
+        }
+    };
+};
+
+/* What a consumer got; `data` is written on whichever thread resumes the consumer */
+struct result {
+    std::atomic<bool> done{false};
+    void* data = nullptr;
+};
+
+static std::atomic<long> sum{0};
+static std::atomic<long> finished{0};
+
+/* ================================================================ */
+
+void* Value(intptr_t value) {
+    return reinterpret_cast<void*>(value);
+}
+
+task consume(sll::queue& queue, result& out) {
+
+    out.data = co_await queue.pop();
+    out.done = true;
+}
+
+/* Adds up what it gets, for the threaded cases */
+task accumulate(sll::queue& queue) {
+
+    void* data = co_await queue.pop();
+
+    sum += reinterpret_cast<intptr_t>(data);
+    finished++;
+}
+
+task drain(sll::queue& queue, std::vector<intptr_t>& seen, result& out) {
+
+    auto stream = sll::stream(queue);
+
+    while (auto data = co_await stream.next()) {
+        seen.push_back(reinterpret_cast<intptr_t>(*data));
+    }
+
+    out.done = true;
+}
+
+void Wait_finished(long count) {
+
+    while (finished.load() < count) {
+        std::this_thread::yield();
+    }
+}
+
+/* ================================================================ */
+
+/* A pop on an empty list suspends until a push hands it the element; a pop on a non-empty one does not */
+void Pop_push(sList_t list) {
+
+    sll::queue queue(list);
+    result out;
+
+    consume(queue, out);
+    assert(!out.done);
+
+    assert(queue.push(Value(7)) == E_OK);
+    assert(out.done && (out.data == Value(7)));
+    assert(sList_size(list) == 0);
+
+    result ready;
+
+    assert(sList_insert_last(list, Value(8)) == E_OK);
+
+    consume(queue, ready);
+    assert(ready.done && (ready.data == Value(8)));
+
+    queue.close();
+}
+
+/* Waiters get elements in the order they started waiting, and the elements in list order */
+void Fifo(sList_t list) {
+
+    sll::queue queue(list);
+    result out[5];
+
+    for (auto& o : out) {
+        consume(queue, o);
+    }
+
+    for (intptr_t i = 1; i <= 5; i++) {
+        assert(queue.push(Value(i)) == E_OK);
+    }
+
+    for (intptr_t i = 0; i < 5; i++) {
+        assert(out[i].done && (out[i].data == Value(i + 1)));
+    }
+
+    queue.close();
+}
+
+/* Elements inserted from C wait for `dispatch`, which resumes no more coroutines than it has elements for */
+void Dispatch(sList_t list) {
+
+    sll::queue queue(list);
+    result out[3];
+
+    for (auto& o : out) {
+        consume(queue, o);
+    }
+
+    assert(queue.dispatch() == 0);
+
+    assert(sList_insert_last(list, Value(1)) == E_OK);
+    assert(sList_insert_last(list, Value(2)) == E_OK);
+
+    assert(!out[0].done);
+
+    assert(queue.dispatch() == 2);
+    assert((out[0].data == Value(1)) && (out[1].data == Value(2)) && !out[2].done);
+
+    queue.close();
+
+    assert(out[2].done && (out[2].data == nullptr));
+}
+
+/* `close` resumes every waiter with `nullptr`; afterwards pops take what is left, then `nullptr` right away */
+void Close(sList_t list) {
+
+    sll::queue queue(list);
+    result out[3];
+
+    for (auto& o : out) {
+        consume(queue, o);
+    }
+
+    queue.close();
+
+    for (auto& o : out) {
+        assert(o.done && (o.data == nullptr));
+    }
+
+    assert(sList_insert_last(list, Value(9)) == E_OK);
+
+    result left;
+    result empty;
+
+    consume(queue, left);
+    consume(queue, empty);
+
+    assert(left.done && (left.data == Value(9)));
+    assert(empty.done && (empty.data == nullptr));
+}
+
+/* A stream yields elements as they are pushed and ends once the queue is closed */
+void Stream(sList_t list) {
+
+    sll::queue queue(list);
+    std::vector<intptr_t> seen;
+    result out;
+
+    drain(queue, seen, out);
+
+    for (intptr_t i = 1; i <= 4; i++) {
+        assert(queue.push(Value(i)) == E_OK);
+    }
+
+    assert(!out.done && (seen == std::vector<intptr_t>({1, 2, 3, 4})));
+
+    queue.close();
+
+    assert(out.done && (seen.size() == 4));
+}
+
+/* ================================================================ */
+
+/*
+ * A thread serving the queue, C producers and another thread pushing through the queue, which dispatches
+ * concurrently with `serve`: every element reaches exactly one coroutine, and none is left behind.
+ */
+void Serve(sList_t list) {
+
+    sll::queue queue(list);
+
+    sum = 0;
+    finished = 0;
+
+    for (size_t i = 0; i < 2 * ITEMS; i++) {
+        accumulate(queue);
+    }
+
+    {
+        std::jthread server([&queue](std::stop_token stop) { queue.serve(stop); });
+
+        std::thread producer([list] {
+            for (intptr_t i = 1; i <= ITEMS; i++) {
+                assert(sList_insert_last(list, Value(i)) == E_OK);
+            }
+        });
+
+        std::thread pusher([&queue] {
+            for (intptr_t i = 1; i <= ITEMS; i++) {
+                assert(queue.push(Value(i)) == E_OK);
+            }
+        });
+
+        producer.join();
+        pusher.join();
+
+        Wait_finished(2 * ITEMS);
+
+        server.request_stop();
+    }
+
+    assert(sum == (long) ITEMS * (ITEMS + 1));
+    assert(sList_size(list) == 0);
+
+    queue.close();
+}
+
+/* A stop leaves an unserved waiter queued, and `close` reaches one `serve` is waiting on an element for */
+void Serve_stop(sList_t list) {
+
+    sll::queue queue(list);
+    result out;
+
+    consume(queue, out);
+
+    {
+        std::jthread server([&queue](std::stop_token stop) { queue.serve(stop); });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+
+    assert(!out.done);
+
+    assert(queue.push(Value(3)) == E_OK);
+    assert(out.done && (out.data == Value(3)));
+
+    result closed;
+
+    consume(queue, closed);
+
+    {
+        std::jthread server([&queue](std::stop_token stop) { queue.serve(stop); });
+
+        /* The server has claimed the waiter and sits in `sList_pop_wait` */
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+        queue.close();
+
+        while (!closed.done) {
+            std::this_thread::yield();
+        }
+    }
+
+    assert(closed.data == nullptr);
+}
+
+/* ================================================================ */
+
+int main() {
+
+    sList_t list = nullptr;
+
+    assert(sList_new(&list, nullptr, nullptr, nullptr) == E_OK);
+
+    /* A queue needs a list to switch to sync mode */
+    bool thrown = false;
+
+    try {
+        sll::queue queue(nullptr);
+    }
+    catch (const std::invalid_argument&) {
+        thrown = true;
+    }
+
+    assert(thrown);
+
+    Pop_push(list);
+    Fifo(list);
+    Dispatch(list);
+    Close(list);
+    Stream(list);
+    Serve(list);
+    Serve_stop(list);
+
+    assert(sList_size(list) == 0);
+    assert(sList_destroy(&list) == E_OK);
+
+    printf("%d elements served to coroutines\n", 2 * ITEMS);
+
+    return EXIT_SUCCESS;
+}
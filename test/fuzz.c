@@ -0,0 +1,887 @@
+#include "../include/sll.h"
+
+#include <stdint.h>
+#include <assert.h>
+
+/*
+ * Drives random sequences of list operations and checks the list against a reference model, a plain array
+ * holding the same data in the same order. Every element is a distinct heap-allocated integer, so an element
+ * can be told apart by its address, and leaks or double frees surface under the sanitizers.
+ *
+ * Built as a standalone program (`make fuzz`), it runs a number of random inputs; built with `-DLIBFUZZER`
+ * (`make libfuzzer`), the inputs come from libFuzzer.
+ */
+
+/* The longest list a single input can build */
+#define CAPACITY 256
+
+static struct {
+    int* items[CAPACITY];
+    size_t size;
+
+    int* cursor;        /* The element `sList_next` returns next, `NULL` to start from the head */
+} model;
+
+/* Used to collect the content of the list */
+static int* seen[CAPACITY];
+static size_t seen_count;
+
+/* Used to remember which elements a predicate keeps */
+static int keep[CAPACITY];
+
+/* The content of the list when a snapshot was taken */
+static int* published[CAPACITY];
+
+/* Blocks handed out and not yet released by the counting allocator */
+static long outstanding;
+
+/* Non-zero if the list's memory comes from the counting allocator, to which the harness returns the copies it removes */
+static int counted;
+
+/* Non-zero if the list has a `destroy` method; otherwise the harness frees the data the list lets go of */
+static int owned;
+
+/* Data the harness frees once the list has let go of it */
+static int* dropped[CAPACITY];
+static size_t dropped_count;
+
+/* ================================================================ */
+
+void* Counting_alloc(void* context, size_t size) {
+
+    (void) context;
+
+    outstanding++;
+
+    return malloc(size);
+}
+
+void Counting_free(void* context, void* pointer) {
+
+    (void) context;
+
+    outstanding--;
+
+    free(pointer);
+}
+
+static const sAllocator_t counting = {Counting_alloc, Counting_free, NULL, 0};
+
+size_t payload_int(void* data) {
+
+    (void) data;
+
+    return sizeof(int);
+}
+
+size_t hash_int(void* data) {
+    return (size_t) *((int*) data);
+}
+
+int match_int(void* data_1, void* data_2) {
+
+    if ((data_1 == NULL) || (data_2 == NULL)) {
+        return -1;
+    }
+
+    return !(*((int*) data_1) == *((int*) data_2));
+}
+
+int collect(void* data) {
+
+    assert(seen_count < CAPACITY);
+
+    seen[seen_count++] = data;
+
+    return 1;
+}
+
+int odd(void* data) {
+    return *((int*) data) & 1;
+}
+
+int multiple_of_3(void* data) {
+    return (*((int*) data) % 3) == 0;
+}
+
+void* Value_copy(void* data) {
+
+    int* value = malloc(sizeof(int));
+
+    assert(value != NULL);
+
+    *value = *((int*) data);
+
+    return value;
+}
+
+/* Copies made by the `_copy` functions hold values below -1, so they can be told apart from data allocated with `malloc` */
+int Copy_value(int* counter) {
+    return -2 - (*counter)++;
+}
+
+int Value_is_copy(const int* value) {
+    return *value < -1;
+}
+
+/* Releases data removed from the list */
+void Value_free(void* data) {
+
+    if (counted && Value_is_copy(data)) {
+        Counting_free(NULL, data);
+    }
+    else {
+        free(data);
+    }
+
+    return ;
+}
+
+/* Remembers data the list is about to let go of without freeing it, having no `destroy` method; copies are always freed by the list */
+void Value_drop(int* value) {
+
+    if (!owned && !Value_is_copy(value)) {
+        assert(dropped_count < CAPACITY);
+
+        dropped[dropped_count++] = value;
+    }
+
+    return ;
+}
+
+/* Frees the data remembered by `Value_drop`, once the list has let go of it */
+void Values_free(void) {
+
+    for (size_t i = 0; i < dropped_count; i++) {
+        free(dropped[i]);
+    }
+
+    dropped_count = 0;
+
+    return ;
+}
+
+int* Value_new(int* counter) {
+
+    int* value = malloc(sizeof(int));
+
+    assert(value != NULL);
+
+    *value = (*counter)++;
+
+    return value;
+}
+
+void Model_insert(size_t index, int* value) {
+
+    memmove(&model.items[index + 1], &model.items[index], (model.size - index) * sizeof(int*));
+
+    model.items[index] = value;
+    model.size++;
+
+    return ;
+}
+
+int* Model_remove(size_t index) {
+
+    int* value = model.items[index];
+
+    memmove(&model.items[index], &model.items[index + 1], (model.size - index - 1) * sizeof(int*));
+
+    model.size--;
+
+    /* The iterator moves on to the element that follows */
+    if (model.cursor == value) {
+        model.cursor = (index < model.size) ? model.items[index] : NULL;
+    }
+
+    return value;
+}
+
+/* Checks that the list holds exactly what the model holds */
+void Model_check(const sList_t list) {
+
+    assert(sList_size(list) == (ssize_t) model.size);
+
+    /* Whatever was charged for the elements is credited back once they are gone */
+    assert((sList_bytes(list) == 0) == (model.size == 0));
+
+    seen_count = 0;
+
+    assert(sList_foreach(list, collect) == (int) model.size);
+    assert(seen_count == model.size);
+
+    for (size_t i = 0; i < model.size; i++) {
+        assert(seen[i] == model.items[i]);
+    }
+
+    return ;
+}
+
+/*
+ * Looks up a value, which the list must hold exactly when the model does, as a walk without a Bloom filter finds.
+ * With a filter, a counter that removes took below the number of elements it counts would hide elements still there.
+ */
+void Model_find(const sList_t list, int value) {
+
+    sNode_t node = NULL;
+
+    int present = 0;
+
+    for (size_t j = 0; (j < model.size) && !present; j++) {
+        present = (*model.items[j] == value);
+    }
+
+    assert(sList_find(list, &value, &node) == E_OK);
+    assert((node != NULL) == present);
+
+    return ;
+}
+
+/* ================================================================ */
+
+int LLVMFuzzerTestOneInput(const uint8_t* input, size_t length) {
+
+    sList_t list = NULL;
+    sNode_t node = NULL;
+    sSnapshot_t snapshot = NULL;
+
+    void* data = NULL;
+
+    int counter = 0;
+    int missing = -1;
+
+    size_t index = 0;
+    size_t capacity = CAPACITY;
+
+    /* Picks the values looked up after every operation */
+    uint32_t probe = (length > 0) ? input[0] : 0;
+
+    memset(&model, 0, sizeof(model));
+
+    /* Some inputs run against a list whose memory is counted, to check every block goes back to the allocator */
+    outstanding = 0;
+
+    counted = (length > 0) && (input[0] & 2);
+
+    /* Some inputs leave the data to the harness; the list still releases the copies it holds */
+    owned = (length == 0) || !(input[0] & 32);
+
+    assert(sList_new_with_allocator(&list, owned ? free : NULL, NULL, match_int, counted ? &counting : NULL) == E_OK);
+
+    /* Some inputs cap the list below the model's capacity; inserting past the cap is then refused */
+    int limited = (length > 0) && (input[0] & 4);
+
+    if (limited) {
+        capacity = (input[0] >> 3) + 1;
+
+        assert(sList_set_payload(list, payload_int) == E_OK);
+        assert(sList_set_limits(list, capacity, 0, 0) == E_OK);
+    }
+
+    /* Some inputs search through a Bloom filter sized for far fewer elements than the list may hold, so its counters collide and saturate */
+    int bloom = (length > 0) && (input[0] & 16);
+
+    if (bloom) {
+        assert(sList_set_hash(list, hash_int) == E_OK);
+
+        /* A false-positive rate must lie strictly between 0 and 1 */
+        assert(sList_set_bloom(list, 8, 0) == E_INVAL);
+        assert(sList_set_bloom(list, 8, 1) == E_INVAL);
+
+        /* A filter too large to be addressed is refused rather than sized in an endless loop */
+        assert(sList_set_bloom(list, (size_t) 1 << 62, 0.01) == E_NOMEM);
+        assert(sList_set_bloom(list, SIZE_MAX, 1e-300) == E_NOMEM);
+        assert(sList_set_bloom(list, 8, 0.05) == E_OK);
+    }
+
+    /* An iterator over an empty list has nothing to return */
+    assert(sList_next(list, &data) != E_OK);
+
+    for (size_t i = 0; i + 1 < length; i += 2) {
+
+        uint8_t operation = input[i] % 24;
+
+        /* The element the operation refers to */
+        index = (model.size > 0) ? input[i + 1] % model.size : 0;
+
+        node = NULL;
+
+        if ((model.size == capacity) && ((operation <= 1) || (operation >= 12))) {
+
+            if (limited) {
+                int value = 0;
+
+                assert(sList_insert_last(list, &value) == E_FULL);
+                assert(sList_insert_first_copy(list, &value, sizeof(value)) == E_FULL);
+            }
+
+            operation = 2;
+        }
+
+        switch (operation) {
+
+            case 0: {
+                int* value = Value_new(&counter);
+
+                assert(sList_insert_first(list, value) == E_OK);
+                Model_insert(0, value);
+
+                break ;
+            }
+
+            case 1: {
+                int* value = Value_new(&counter);
+
+                assert(sList_insert_last(list, value) == E_OK);
+                Model_insert(model.size, value);
+
+                break ;
+            }
+
+            case 2:
+                assert(sList_remove_first(list, &data) == E_OK);
+
+                if (model.size > 0) {
+                    assert(data == Model_remove(0));
+                    Value_free(data);
+                }
+
+                break ;
+
+            case 3:
+                assert(sList_remove_last(list, &data) == E_OK);
+
+                if (model.size > 0) {
+                    assert(data == Model_remove(model.size - 1));
+                    Value_free(data);
+                }
+
+                break ;
+
+            case 4:
+            case 5: {
+                if ((model.size == 0) || (model.size == capacity)) {
+                    break ;
+                }
+
+                int* value = Value_new(&counter);
+
+                assert(sList_find(list, model.items[index], &node) == E_OK);
+
+                if (operation == 4) {
+                    assert(sList_insert_after(list, node, value) == E_OK);
+                    Model_insert(index + 1, value);
+                }
+                else {
+                    assert(sList_insert_before(list, node, value) == E_OK);
+                    Model_insert(index, value);
+                }
+
+                break ;
+            }
+
+            case 6:
+                if (model.size == 0) {
+                    break ;
+                }
+
+                assert(sList_find(list, model.items[index], &node) == E_OK);
+                assert(sList_delete_Node(list, node, &data) == E_OK);
+                assert(data == Model_remove(index));
+
+                Value_free(data);
+
+                break ;
+
+            case 7:
+                assert(sList_find(list, &missing, &node) == E_OK);
+                assert(node == NULL);
+
+                break ;
+
+            case 8:
+                if (model.size == 0) {
+                    assert(sList_next(list, &data) != E_OK);
+
+                    break ;
+                }
+
+                if (model.cursor == NULL) {
+                    model.cursor = model.items[0];
+                }
+
+                assert(sList_next(list, &data) == E_OK);
+                assert(data == model.cursor);
+
+                for (size_t j = 0; j < model.size; j++) {
+
+                    if (model.items[j] == model.cursor) {
+                        model.cursor = (j + 1 < model.size) ? model.items[j + 1] : NULL;
+
+                        break ;
+                    }
+                }
+
+                break ;
+
+            case 9: {
+                sList_t other = NULL;
+
+                /* Nodes of another list are foreign */
+                if (model.size == 0) {
+                    break ;
+                }
+
+                assert(sList_new(&other, NULL, NULL, match_int) == E_OK);
+                assert(sList_insert_last(other, &missing) == E_OK);
+                assert(sList_insert_last(other, &counter) == E_OK);
+                assert(sList_find(other, &missing, &node) == E_OK);
+
+                assert(sList_insert_after(list, node, &missing) == E_MATCH);
+                assert(sList_insert_before(list, node, &missing) == E_MATCH);
+
+                assert(sNode_belongs(node, list) != 0);
+                assert(sNode_belongs(node, other) == 0);
+
+                sList_destroy(&other);
+
+                break ;
+            }
+
+            case 10:
+                assert(sList_publish(list) == E_OK);
+                assert(sList_snapshot(list, &snapshot) == E_OK);
+                assert(sSnapshot_size(snapshot) == (ssize_t) model.size);
+
+                for (size_t j = 0; j < model.size; j++) {
+                    assert((sSnapshot_at(snapshot, j, &data) == E_OK) && (data == model.items[j]));
+                }
+
+                assert(sSnapshot_release(&snapshot) == E_OK);
+
+                break ;
+
+            case 11:
+                /* NULL data is rejected and leaves the list untouched */
+                assert(sList_insert_last(list, NULL) == E_NULL_V);
+                assert(sList_insert_first(list, NULL) == E_NULL_V);
+                assert(sList_insert_last_copy(list, NULL, sizeof(int)) == E_NULL_V);
+                assert(sList_insert_last_copy(list, &missing, 0) == E_NULL_V);
+
+                break ;
+
+            /* Copies live in the node's allocation; the model learns their address from the list */
+            case 12: {
+                int value = Copy_value(&counter);
+
+                assert(sList_insert_last_copy(list, &value, sizeof(value)) == E_OK);
+                assert(sList_peek_last(list, &data) == E_OK);
+                assert((data != &value) && (*((int*) data) == value));
+
+                Model_insert(model.size, data);
+
+                break ;
+            }
+
+            case 13: {
+                int value = Copy_value(&counter);
+
+                assert(sList_insert_first_copy(list, &value, sizeof(value)) == E_OK);
+                assert(sList_peek_first(list, &data) == E_OK);
+                assert((data != &value) && (*((int*) data) == value));
+
+                Model_insert(0, data);
+
+                break ;
+            }
+
+            case 14: {
+                int value = Copy_value(&counter);
+
+                if (model.size == 0) {
+                    break ;
+                }
+
+                assert(sList_find(list, model.items[index], &node) == E_OK);
+                assert(sList_insert_after_copy(list, node, &value, sizeof(value)) == E_OK);
+
+                seen_count = 0;
+                sList_foreach(list, collect);
+
+                assert(*seen[index + 1] == value);
+
+                Model_insert(index + 1, seen[index + 1]);
+
+                break ;
+            }
+
+            /* Positional access goes through the finger, which every other operation has to keep right */
+            case 15:
+                if (model.size == 0) {
+                    assert(sList_at(list, 0, &data) == E_NOTFOUND);
+
+                    break ;
+                }
+
+                assert(sList_at(list, index, &data) == E_OK);
+                assert(data == model.items[index]);
+
+                assert(sList_at(list, model.size, &data) == E_NOTFOUND);
+
+                break ;
+
+            case 16: {
+                int* value = Value_new(&counter);
+
+                /* Any position up to and including the end */
+                index = input[i + 1] % (model.size + 1);
+
+                assert(sList_insert_at(list, index, value) == E_OK);
+                Model_insert(index, value);
+
+                break ;
+            }
+
+            case 17:
+                if (model.size == 0) {
+                    assert(sList_remove_at(list, 0, &data) == E_NOTFOUND);
+
+                    break ;
+                }
+
+                assert(sList_remove_at(list, index, &data) == E_OK);
+                assert(data == Model_remove(index));
+
+                Value_free(data);
+
+                break ;
+
+            case 18:
+                assert(sList_reverse(list) == E_OK);
+
+                for (size_t j = 0; j < model.size / 2; j++) {
+                    int* value = model.items[j];
+
+                    model.items[j] = model.items[model.size - 1 - j];
+                    model.items[model.size - 1 - j] = value;
+                }
+
+                /* Reversing restarts the iterator */
+                model.cursor = NULL;
+
+                break ;
+
+            /* Filtering destroys the elements it drops; partitioning moves them to a new list */
+            case 19:
+            case 20: {
+                sList_t out = NULL;
+                size_t kept = 0;
+
+                int (*predicate)(void* data) = (input[i + 1] & 1) ? odd : multiple_of_3;
+
+                /* A reader holds a snapshot across the partition, and reads it once the list moved out is gone */
+                if ((operation == 20) && (input[i + 1] & 2)) {
+                    assert(sList_publish(list) == E_OK);
+                    assert(sList_snapshot(list, &snapshot) == E_OK);
+
+                    memcpy(published, model.items, model.size * sizeof(int*));
+                }
+
+                /* Filtering frees what it drops, so the model is judged first */
+                for (size_t j = 0; j < model.size; j++) {
+                    keep[j] = predicate(model.items[j]);
+
+                    if (!keep[j]) {
+                        Value_drop(model.items[j]);
+                    }
+                }
+
+                if (operation == 19) {
+                    assert(sList_filter(list, predicate) == E_OK);
+                }
+                else {
+                    assert(sList_partition(list, predicate, &out) == E_OK);
+
+                    seen_count = 0;
+                    sList_foreach(out, collect);
+                }
+
+                for (size_t j = 0, k = 0; j < model.size; j++) {
+
+                    if (keep[j]) {
+                        model.items[kept++] = model.items[j];
+                    }
+                    else if (operation == 20) {
+                        assert(seen[k++] == model.items[j]);
+                    }
+                    /* The filtered-out element is gone; the iterator has moved past it */
+                    else if (model.cursor == model.items[j]) {
+                        model.cursor = (j + 1 < model.size) ? model.items[j + 1] : NULL;
+                    }
+                }
+
+                if (operation == 20) {
+                    assert(sList_size(out) == (ssize_t) (model.size - kept));
+                    assert(sList_destroy(&out) == E_OK);
+
+                    model.cursor = NULL;
+                }
+
+                if (snapshot != NULL) {
+                    assert(sSnapshot_size(snapshot) == (ssize_t) model.size);
+
+                    /* Reads every value, including those of the elements destroyed with `out` */
+                    assert(sSnapshot_foreach(snapshot, odd) >= 0);
+
+                    for (size_t j = 0; j < model.size; j++) {
+                        assert((sSnapshot_at(snapshot, j, &data) == E_OK) && (data == published[j]));
+                    }
+
+                    assert(sSnapshot_release(&snapshot) == E_OK);
+                }
+
+                Values_free();
+
+                model.size = kept;
+
+                break ;
+            }
+
+            /* A view of a window of the list, then the same window split in three */
+            case 21: {
+                sView_t view;
+                sView_t parts[3];
+
+                size_t start = input[i + 1] % (model.size + 1);
+                size_t length = (input[i + 1] >> 3) % 16;
+
+                assert(sList_view(list, start, length, &view) == E_OK);
+
+                if (length > model.size - start) {
+                    length = model.size - start;
+                }
+
+                assert(sView_size(&view) == (ssize_t) length);
+
+                seen_count = 0;
+                assert(sView_foreach(&view, collect) == (int) length);
+
+                for (size_t j = 0; j < length; j++) {
+                    assert(seen[j] == model.items[start + j]);
+                    assert((sView_next(&view, &data) == E_OK) && (data == seen[j]));
+                }
+
+                assert(sView_next(&view, &data) == E_NOTFOUND);
+
+                assert(sView_find(&view, &missing, &node) == E_NOTFOUND);
+
+                if (length > 0) {
+                    assert(sView_find(&view, model.items[start + length - 1], &node) == E_OK);
+                }
+
+                assert(sView_split(&view, 0, parts) == E_INVAL);
+                assert(sView_split(&view, 3, parts) == E_OK);
+
+                seen_count = 0;
+
+                for (size_t j = 0; j < 3; j++) {
+                    sView_foreach(&parts[j], collect);
+                }
+
+                assert(seen_count == length);
+
+                for (size_t j = 0; j < length; j++) {
+                    assert(seen[j] == model.items[start + j]);
+                }
+
+                assert(sList_view(list, model.size + 1, 1, &view) == E_NOTFOUND);
+
+                break ;
+            }
+
+            /* A deep copy holds equal values at other addresses */
+            case 22: {
+                sList_t clone = NULL;
+
+                /* The clone's nodes and inline copies go back to the allocator with it */
+                long before = outstanding;
+
+                assert(sList_clone_parallel(list, &clone, Value_copy, 1 + input[i + 1] % 3) == E_OK);
+                assert(sList_size(clone) == (ssize_t) model.size);
+
+                seen_count = 0;
+                sList_foreach(clone, collect);
+
+                for (size_t j = 0; j < model.size; j++) {
+                    assert((seen[j] != model.items[j]) && (*seen[j] == *model.items[j]));
+                }
+
+                /* Carrying on with the clone puts nodes that share a block through every other operation */
+                if ((input[i + 1] & 8) && !counted) {
+                    for (size_t j = 0; j < model.size; j++) {
+                        Value_drop(model.items[j]);
+                    }
+
+                    assert(sList_destroy(&list) == E_OK);
+                    Values_free();
+
+                    list = clone;
+
+                    memcpy(model.items, seen, model.size * sizeof(int*));
+                    model.cursor = NULL;
+
+                    if (limited) {
+                        assert(sList_set_limits(list, capacity, 0, 0) == E_OK);
+                    }
+
+                    break ;
+                }
+
+                for (size_t j = 0; j < model.size; j++) {
+                    Value_drop(seen[j]);
+                }
+
+                assert(sList_destroy(&clone) == E_OK);
+                assert(outstanding == before);
+
+                Values_free();
+
+                break ;
+            }
+
+            /* Duplicates of a few elements go anywhere in the list, and deduplicating keeps the first of each value */
+            case 23: {
+                size_t kept = 0;
+                size_t count = input[i + 1] % 4;
+
+                /* The filter needs the hash method, so only lists without one compare every pair */
+                if (!bloom) {
+                    assert(sList_set_hash(list, (input[i + 1] & 4) ? hash_int : NULL) == E_OK);
+                }
+
+                for (size_t j = 0; (j < count) && (model.size > 0) && (model.size < capacity); j++) {
+
+                    int* original = model.items[input[i + 1] % model.size];
+
+                    /* A copy is duplicated by another copy, at the end; other data anywhere */
+                    if (Value_is_copy(original)) {
+                        assert(sList_insert_last_copy(list, original, sizeof(int)) == E_OK);
+                        assert(sList_peek_last(list, &data) == E_OK);
+
+                        Model_insert(model.size, data);
+                    }
+                    else {
+                        int* value = Value_copy(original);
+
+                        index = (input[i + 1] + j * 37) % (model.size + 1);
+
+                        assert(sList_insert_at(list, index, value) == E_OK);
+                        Model_insert(index, value);
+                    }
+                }
+
+                /* Deduplicating frees what it drops, so the model is judged first */
+                for (size_t j = 0; j < model.size; j++) {
+                    keep[j] = 1;
+
+                    for (size_t k = 0; (k < j) && keep[j]; k++) {
+                        keep[j] = (*model.items[k] != *model.items[j]);
+                    }
+
+                    if (!keep[j]) {
+                        Value_drop(model.items[j]);
+                    }
+                }
+
+                assert(sList_unique(list) == E_OK);
+
+                for (size_t j = 0; j < model.size; j++) {
+
+                    if (keep[j]) {
+                        model.items[kept++] = model.items[j];
+                    }
+                    /* A dropped element is gone; the iterator has moved past it */
+                    else if (model.cursor == model.items[j]) {
+                        model.cursor = (j + 1 < model.size) ? model.items[j + 1] : NULL;
+                    }
+                }
+
+                Values_free();
+
+                model.size = kept;
+
+                break ;
+            }
+        }
+
+        Model_check(list);
+
+        /* Values the list holds, has held or has never held, plain and copied, with removes in between */
+        if (bloom) {
+            for (size_t j = 0; j < 8; j++) {
+                probe = probe * 1103515245u + 12345u;
+
+                Model_find(list, (int) ((probe >> 8) % (2 * (uint32_t) counter + 3)) - counter - 2);
+            }
+        }
+    }
+
+    if (bloom) {
+        for (size_t j = 0; j < model.size; j++) {
+            Model_find(list, *model.items[j]);
+        }
+    }
+
+    for (size_t j = 0; j < model.size; j++) {
+        Value_drop(model.items[j]);
+    }
+
+    if ((length > 0) && (input[0] & 1)) {
+        assert(sList_destroy_async(&list) == E_OK);
+
+        while (sList_reclaim_step(16) > 0) ;
+    }
+    else {
+        assert(sList_destroy(&list) == E_OK);
+    }
+
+    assert(list == NULL);
+
+    Values_free();
+
+    assert(outstanding == 0);
+
+    return 0;
+}
+
+/* ================================================================ */
+
+#ifndef LIBFUZZER
+
+int main(int argc, char** argv) {
+
+    uint8_t input[2 * CAPACITY];
+
+    unsigned int seed = (argc > 1) ? strtoul(argv[1], NULL, 10) : (unsigned int) time(NULL);
+    size_t runs = (argc > 2) ? strtoull(argv[2], NULL, 10) : 10000;
+
+    srand(seed);
+
+    for (size_t r = 0; r < runs; r++) {
+
+        size_t length = rand() % sizeof(input);
+
+        for (size_t i = 0; i < length; i++) {
+            input[i] = rand();
+        }
+
+        LLVMFuzzerTestOneInput(input, length);
+    }
+
+    printf("%zu runs passed (seed %u)\n", runs, seed);
+
+    return EXIT_SUCCESS;
+}
+
+#endif /* LIBFUZZER */
@@ -0,0 +1,335 @@
+#include "../include/sll.h"
+
+#include <stdint.h>
+#include <assert.h>
+
+/*
+ * Drives random sequences of priority queue operations and checks the queue against the model, which keeps
+ * its elements sorted by key. Keys are drawn from a small range, so many elements tie. Handles to removed
+ * elements are kept and checked to stay stale while their slots are recycled.
+ */
+
+/* The most elements a run holds, and the number of stale handles kept */
+#define CAPACITY 256
+#define STALE 64
+
+typedef struct {
+    int key;
+
+    sHNode_t handle;
+    int has_handle;     /* Elements moved in by `sHeap_heapify` have none */
+} Element;
+
+#define MODEL_ITEM Element
+#define MODEL_CAPACITY CAPACITY
+
+#include "model.h"
+
+static sHNode_t stale[STALE];
+static size_t stale_count;
+
+/* ================================================================ */
+
+int compare(void* data_1, void* data_2) {
+
+    int a = ((Element*) data_1)->key;
+    int b = ((Element*) data_2)->key;
+
+    return (a > b) - (a < b);
+}
+
+Element* Element_new(void) {
+
+    Element* element = calloc(1, sizeof(Element));
+
+    assert(element != NULL);
+
+    element->key = rand() % 100;
+
+    return element;
+}
+
+/* Inserts an element in key order, after those with the same key */
+void Model_add(Element* element) {
+
+    size_t i = 0;
+
+    for (; (i < model.size) && (model.items[i]->key <= element->key); i++) ;
+
+    Model_insert(i, element);
+
+    return ;
+}
+
+/* Removes a given element, recording its handle as stale */
+void Model_drop(Element* element) {
+
+    Model_take(element);
+
+    if (element->has_handle) {
+        stale[stale_count++ % STALE] = element->handle;
+    }
+
+    return ;
+}
+
+/* Picks a random element that has a handle, `NULL` if there is none */
+Element* Model_pick(void) {
+
+    size_t start = (model.size > 0) ? rand() % model.size : 0;
+
+    for (size_t i = 0; i < model.size; i++) {
+
+        Element* element = model.items[(start + i) % model.size];
+
+        if (element->has_handle) {
+            return element;
+        }
+    }
+
+    return NULL;
+}
+
+void Insert(const sHeap_t heap) {
+
+    Element* element = Element_new();
+
+    assert(sHeap_insert(heap, element, &element->handle) == E_OK);
+    element->has_handle = 1;
+
+    Model_add(element);
+
+    return ;
+}
+
+void Model_check(const sHeap_t heap) {
+
+    void* data = NULL;
+    Element other = {0};
+
+    assert(sHeap_size(heap) == (ssize_t) model.size);
+
+    if (model.size == 0) {
+        assert(sHeap_peek_min(heap, &data) == E_NOTFOUND);
+    }
+    else {
+        assert(sHeap_peek_min(heap, &data) == E_OK);
+        assert(((Element*) data)->key == model.items[0]->key);
+    }
+
+    /* Slots are recycled, handles to their old elements are not */
+    for (size_t i = 0; (i < stale_count) && (i < STALE); i++) {
+        assert(sHeap_decrease_key(heap, stale[i], &other) == E_MATCH);
+        assert(sHeap_remove(heap, stale[i], &data) == E_MATCH);
+    }
+
+    return ;
+}
+
+/* ================================================================ */
+
+void Run(sHeap_t heap, size_t steps) {
+
+    void* data = NULL;
+
+    for (size_t s = 0; s < steps; s++) {
+
+        int operation = rand() % 8;
+
+        if ((model.size + 64 > CAPACITY) && ((operation <= 1) || (operation == 5) || (operation == 6))) {
+            operation = 2;
+        }
+
+        switch (operation) {
+
+            case 0:
+            case 1:
+                Insert(heap);
+
+                break ;
+
+            case 2:
+                if (model.size == 0) {
+                    assert(sHeap_pop_min(heap, &data) == E_NOTFOUND);
+
+                    break ;
+                }
+
+                assert(sHeap_pop_min(heap, &data) == E_OK);
+                assert(((Element*) data)->key == model.items[0]->key);
+
+                Model_drop(data);
+                free(data);
+
+                break ;
+
+            case 3: {
+                Element* element = Model_pick();
+
+                if (element == NULL) {
+                    break ;
+                }
+
+                Element later = {element->key + 1, {NULL, 0}, 0};
+
+                /* A later key is refused and leaves the element alone */
+                assert(sHeap_decrease_key(heap, element->handle, &later) == E_INVAL);
+
+                /* The key is changed in place, so the model has to re-sort it */
+                Model_take(element);
+
+                element->key -= rand() % 20;
+
+                assert(sHeap_decrease_key(heap, element->handle, element) == E_OK);
+                Model_add(element);
+
+                break ;
+            }
+
+            case 4: {
+                Element* element = Model_pick();
+
+                if (element == NULL) {
+                    break ;
+                }
+
+                assert(sHeap_remove(heap, element->handle, &data) == E_OK);
+                assert(data == element);
+
+                Model_drop(element);
+                free(element);
+
+                break ;
+            }
+
+            /* Another queue's elements move in with their handles */
+            case 5: {
+                sHeap_t other = NULL;
+                sHeap_t foreign = NULL;
+
+                void* popped = NULL;
+                size_t count = rand() % 64;
+
+                assert(sHeap_new(&other, free, compare) == E_OK);
+
+                for (size_t i = 0; i < count; i++) {
+                    Element* element = Element_new();
+
+                    assert(sHeap_insert(other, element, &element->handle) == E_OK);
+                    element->has_handle = 1;
+
+                    Model_add(element);
+                }
+
+                /* The other queue's free elements come along, and are recycled next */
+                if (count > 0) {
+                    assert(sHeap_pop_min(other, &popped) == E_OK);
+
+                    Model_drop(popped);
+                    free(popped);
+                }
+
+                /* Queues that do not order alike cannot be merged */
+                assert(sHeap_new(&foreign, NULL, compare) == E_OK);
+                assert(sHeap_merge(heap, &foreign) == E_MISMET);
+                assert(sHeap_destroy(&foreign) == E_OK);
+
+                assert(sHeap_merge(heap, &other) == E_OK);
+                assert(other == NULL);
+
+                break ;
+            }
+
+            /* A list's data moves in, without handles */
+            case 6: {
+                sList_t list = NULL;
+                size_t count = rand() % 64;
+
+                assert(sList_new(&list, NULL, NULL, NULL) == E_OK);
+
+                for (size_t i = 0; i < count; i++) {
+                    Element* element = Element_new();
+
+                    assert(sList_insert_last(list, element) == E_OK);
+
+                    Model_add(element);
+                }
+
+                assert(sHeap_heapify(heap, list) == E_OK);
+                assert(sList_size(list) == 0);
+
+                assert(sList_destroy(&list) == E_OK);
+
+                break ;
+            }
+
+            /* A list holding a copy, which lives in its node, is refused and left as it was */
+            case 7: {
+                sList_t list = NULL;
+                Element copy = {0};
+
+                assert(sList_new(&list, NULL, NULL, NULL) == E_OK);
+
+                assert(sList_insert_last(list, Element_new()) == E_OK);
+                assert(sList_insert_last_copy(list, &copy, sizeof(copy)) == E_OK);
+
+                assert(sHeap_heapify(heap, list) == E_MISMET);
+                assert(sList_size(list) == 2);
+
+                assert(sList_remove_first(list, &data) == E_OK);
+                free(data);
+
+                assert(sList_destroy(&list) == E_OK);
+
+                break ;
+            }
+        }
+
+        Model_check(heap);
+    }
+
+    /* Popping everything returns the keys in order */
+    while (model.size > 0) {
+        assert(sHeap_pop_min(heap, &data) == E_OK);
+        assert(((Element*) data)->key == model.items[0]->key);
+
+        Model_drop(data);
+        free(data);
+    }
+
+    Model_check(heap);
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(int argc, char** argv) {
+
+    sHeap_t heap = NULL;
+
+    unsigned int seed = 0;
+    size_t runs = Model_runs(argc, argv, 1000, &seed);
+
+    for (size_t r = 0; r < runs; r++) {
+
+        Model_reset();
+        stale_count = 0;
+
+        assert(sHeap_new(&heap, free, compare) == E_OK);
+
+        Run(heap, rand() % 512);
+
+        /* Destroying the queue destroys what is left in it */
+        for (size_t i = 0; i < 100; i++) {
+            assert(sHeap_insert(heap, Element_new(), NULL) == E_OK);
+        }
+
+        assert(sHeap_destroy(&heap) == E_OK);
+        assert(heap == NULL);
+    }
+
+    printf("%zu runs passed (seed %u)\n", runs, seed);
+
+    return EXIT_SUCCESS;
+}
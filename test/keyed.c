@@ -0,0 +1,208 @@
+#include "../include/sll.h"
+
+#include <stdint.h>
+#include <assert.h>
+
+/*
+ * Drives random sequences of keyed list operations and checks the list against the model, which holds the same
+ * elements in the same order, each holding the key it was inserted under. Keys are drawn from a small range, so
+ * many elements share a key and a lookup has to return the first of them. Runs grow lists over many chunks,
+ * then remove from anywhere in them, so chunks split by inserts at the head and merge again as they empty.
+ */
+
+/* The longest list a run builds, and the number of distinct keys */
+#define CAPACITY 1024
+#define KEYS 48
+
+/* The data of an element, which also holds the key it was inserted under */
+typedef struct {
+    uint32_t key;
+} Element;
+
+#define MODEL_ITEM Element
+#define MODEL_CAPACITY CAPACITY
+
+#include "model.h"
+
+static size_t destroyed;
+
+/* ================================================================ */
+
+void destroy(void* data) {
+
+    destroyed++;
+
+    free(data);
+}
+
+Element* Element_new(uint32_t key) {
+
+    Element* element = malloc(sizeof(Element));
+
+    assert(element != NULL);
+
+    element->key = key;
+
+    return element;
+}
+
+/* The position of the first element with a given key, `model.size` if there is none */
+size_t Model_find(uint32_t key) {
+
+    size_t i = 0;
+
+    for (; (i < model.size) && (model.items[i]->key != key); i++) ;
+
+    return i;
+}
+
+void Model_check(const sKList_t list) {
+
+    void* data = NULL;
+
+    assert(sKList_size(list) == (ssize_t) model.size);
+
+    seen_count = 0;
+
+    assert(sKList_foreach(list, collect) == (int) model.size);
+
+    Model_check_seen();
+
+    /* Every key finds its first element, wherever chunk boundaries fall */
+    for (uint32_t key = 0; key <= KEYS; key++) {
+
+        size_t index = Model_find(key);
+
+        if (index == model.size) {
+            assert(sKList_find(list, key, &data) == E_NOTFOUND);
+        }
+        else {
+            assert((sKList_find(list, key, &data) == E_OK) && (data == model.items[index]));
+        }
+    }
+
+    return ;
+}
+
+/* ================================================================ */
+
+void Run(const sKList_t list, size_t steps) {
+
+    void* data = NULL;
+
+    /* Runs fill up for a while, then mostly drain */
+    size_t filling = rand() % steps;
+
+    for (size_t s = 0; s < steps; s++) {
+
+        /* Key `KEYS` is never inserted, so lookups of it always miss */
+        uint32_t key = rand() % (KEYS + 1);
+        int operation = rand() % 8;
+
+        if (model.size == CAPACITY) {
+            operation = 4;
+        }
+        else if ((s < filling) && (operation >= 4)) {
+            operation %= 4;
+        }
+
+        switch (operation) {
+
+            case 0:
+            case 1: {
+                Element* element = Element_new(key % KEYS);
+
+                assert(sKList_insert_last(list, element->key, element) == E_OK);
+                Model_insert(model.size, element);
+
+                break ;
+            }
+
+            case 2: {
+                Element* element = Element_new(key % KEYS);
+
+                assert(sKList_insert_first(list, element->key, element) == E_OK);
+                Model_insert(0, element);
+
+                break ;
+            }
+
+            case 3: {
+                size_t index = Model_find(key);
+
+                if (index == model.size) {
+                    assert(sKList_find(list, key, &data) == E_NOTFOUND);
+                }
+                else {
+                    assert((sKList_find(list, key, &data) == E_OK) && (data == model.items[index]));
+                }
+
+                break ;
+            }
+
+            default: {
+                /* Usually the key of an element, so removes reach anywhere in the list */
+                if ((model.size > 0) && (key != KEYS)) {
+                    key = model.items[rand() % model.size]->key;
+                }
+
+                size_t index = Model_find(key);
+
+                if (index == model.size) {
+                    assert(sKList_remove(list, key, &data) == E_NOTFOUND);
+
+                    break ;
+                }
+
+                assert(sKList_remove(list, key, &data) == E_OK);
+                assert(data == Model_remove(index));
+
+                free(data);
+
+                break ;
+            }
+        }
+
+        Model_check(list);
+    }
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(int argc, char** argv) {
+
+    sKList_t list = NULL;
+
+    void* data = NULL;
+
+    unsigned int seed = 0;
+    size_t runs = Model_runs(argc, argv, 200, &seed);
+
+    assert(sKList_new(NULL, NULL) == E_NULL_V);
+
+    for (size_t r = 0; r < runs; r++) {
+
+        Model_reset();
+        destroyed = 0;
+
+        assert(sKList_new(&list, destroy) == E_OK);
+
+        assert(sKList_find(list, 0, &data) == E_NOTFOUND);
+        assert(sKList_remove(list, 0, &data) == E_NOTFOUND);
+        assert(sKList_insert_last(list, 0, NULL) == E_NULL_V);
+
+        Run(list, 1 + rand() % 2048);
+
+        /* Destroying the list destroys what is left in it */
+        size_t left = model.size;
+
+        assert(sKList_destroy(&list) == E_OK);
+        assert((list == NULL) && (destroyed == left));
+    }
+
+    printf("%zu runs passed (seed %u)\n", runs, seed);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,220 @@
+#include "../include/sll.h"
+
+#include <stdint.h>
+#include <assert.h>
+
+/*
+ * Drives random sequences of cache operations and checks the cache against the model, which holds its entries
+ * from the most to the least recently used. Keys are drawn from a small range and hashed weakly, so most entries
+ * share a bucket chain with others and replacing, removing and evicting unlink them from the middle of chains.
+ */
+
+/* The largest capacity a run uses, and the number of distinct keys */
+#define CAPACITY 32
+#define KEYS 48
+
+typedef struct {
+    int key;
+    int version;    /* Tells apart the data put under the same key */
+} Entry;
+
+#define MODEL_ITEM Entry
+#define MODEL_CAPACITY KEYS
+
+#include "model.h"
+
+/* Entries destroyed by the cache */
+static long destroyed;
+
+/* ================================================================ */
+
+void Entry_destroy(void* data) {
+
+    destroyed++;
+
+    free(data);
+}
+
+size_t Entry_hash(void* data) {
+
+    /* Four buckets' worth of hashes, whatever the size of the table */
+    return (size_t) (((Entry*) data)->key % 4);
+}
+
+int Entry_match(void* data_1, void* data_2) {
+    return ((Entry*) data_1)->key != ((Entry*) data_2)->key;
+}
+
+Entry* Entry_new(int key, int* version) {
+
+    Entry* entry = malloc(sizeof(Entry));
+
+    assert(entry != NULL);
+
+    entry->key = key;
+    entry->version = (*version)++;
+
+    return entry;
+}
+
+/* Returns the position of the entry with a given key, or -1 */
+ssize_t Model_find(int key) {
+
+    for (size_t i = 0; i < model.size; i++) {
+
+        if (model.items[i]->key == key) {
+            return (ssize_t) i;
+        }
+    }
+
+    return -1;
+}
+
+/* ================================================================ */
+
+void Run(sLRU_t lru, size_t capacity, size_t steps) {
+
+    Entry key;
+    void* data = NULL;
+
+    int version = 0;
+
+    long expected = 0;
+
+    for (size_t s = 0; s < steps; s++) {
+
+        ssize_t index = 0;
+
+        key.key = rand() % KEYS;
+        index = Model_find(key.key);
+
+        switch (rand() % 5) {
+
+            case 0: {
+                Entry* entry = Entry_new(key.key, &version);
+
+                assert(sLRU_put(lru, entry) == E_OK);
+
+                /* The replaced data is destroyed */
+                if (index >= 0) {
+                    Model_remove(index);
+                    expected++;
+                }
+
+                Model_insert(0, entry);
+
+                /* The least recently used entry is evicted */
+                if ((capacity > 0) && (model.size > capacity)) {
+                    model.size--;
+                    expected++;
+                }
+
+                break ;
+            }
+
+            case 1:
+                if (index < 0) {
+                    assert(sLRU_get(lru, &key, &data) == E_NOTFOUND);
+
+                    break ;
+                }
+
+                assert(sLRU_get(lru, &key, &data) == E_OK);
+                assert(data == model.items[index]);
+
+                Model_insert(0, Model_remove(index));
+
+                break ;
+
+            case 2:
+                if (index < 0) {
+                    assert(sLRU_touch(lru, &key) == E_NOTFOUND);
+
+                    break ;
+                }
+
+                assert(sLRU_touch(lru, &key) == E_OK);
+
+                Model_insert(0, Model_remove(index));
+
+                break ;
+
+            case 3:
+                if (index < 0) {
+                    assert(sLRU_remove(lru, &key, &data) == E_NOTFOUND);
+
+                    break ;
+                }
+
+                assert(sLRU_remove(lru, &key, &data) == E_OK);
+                assert(data == Model_remove(index));
+
+                free(data);
+
+                break ;
+
+            case 4:
+                if (model.size == 0) {
+                    assert(sLRU_evict(lru, &data) == E_NOTFOUND);
+
+                    break ;
+                }
+
+                assert(sLRU_evict(lru, &data) == E_OK);
+                assert(data == Model_remove(model.size - 1));
+
+                free(data);
+
+                break ;
+        }
+
+        assert(sLRU_size(lru) == (ssize_t) model.size);
+        assert(destroyed == expected);
+    }
+
+    /* Evicting everything returns the entries from the least to the most recently used */
+    while (model.size > 0) {
+        assert(sLRU_evict(lru, &data) == E_OK);
+        assert(data == Model_remove(model.size - 1));
+
+        free(data);
+    }
+
+    assert(sLRU_size(lru) == 0);
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(int argc, char** argv) {
+
+    sLRU_t lru = NULL;
+
+    unsigned int seed = 0;
+    size_t runs = Model_runs(argc, argv, 1000, &seed);
+
+    for (size_t r = 0; r < runs; r++) {
+
+        /* Some runs are unbounded */
+        size_t capacity = rand() % (CAPACITY + 1);
+
+        Model_reset();
+        destroyed = 0;
+
+        assert(sLRU_new(&lru, capacity, Entry_destroy, Entry_hash, Entry_match) == E_OK);
+
+        Run(lru, capacity, rand() % 512);
+
+        /* Destroying the cache destroys what is left in it */
+        assert(sLRU_put(lru, Entry_new(0, &(int) {0})) == E_OK);
+        destroyed = 0;
+
+        assert(sLRU_destroy(&lru) == E_OK);
+        assert((lru == NULL) && (destroyed == 1));
+    }
+
+    printf("%zu runs passed (seed %u)\n", runs, seed);
+
+    return EXIT_SUCCESS;
+}
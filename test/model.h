@@ -0,0 +1,129 @@
+#ifndef model_h
+#define model_h
+
+/*
+ * The reference model shared by the model tests: the elements a container should hold, kept in a plain array
+ * in the order the test gives them, and what a test needs around it to collect a container's content and to
+ * run from a seed given on the command line.
+ *
+ * A test defines `MODEL_ITEM`, the type its elements point to, and `MODEL_CAPACITY`, the most elements a model
+ * holds, before including this header.
+ */
+
+#include "../include/sll.h"
+
+#include <stdint.h>
+#include <assert.h>
+
+#ifndef MODEL_ITEM
+#define MODEL_ITEM int
+#endif
+
+#ifndef MODEL_CAPACITY
+#define MODEL_CAPACITY 256
+#endif
+
+static struct {
+    MODEL_ITEM* items[MODEL_CAPACITY];
+    size_t size;
+} model;
+
+/* Used to collect the content of a container */
+static MODEL_ITEM* seen[MODEL_CAPACITY];
+static size_t seen_count;
+
+/* ================================================================ */
+
+static inline int collect(void* data) {
+
+    assert(seen_count < MODEL_CAPACITY);
+
+    seen[seen_count++] = data;
+
+    return 1;
+}
+
+/* A distinct heap-allocated integer, so an element can be told apart by its address */
+static inline int* Value_new(int* counter) {
+
+    int* value = malloc(sizeof(int));
+
+    assert(value != NULL);
+
+    *value = (*counter)++;
+
+    return value;
+}
+
+/* ================================ */
+
+static inline void Model_insert(size_t index, MODEL_ITEM* item) {
+
+    assert((model.size < MODEL_CAPACITY) && (index <= model.size));
+
+    memmove(&model.items[index + 1], &model.items[index], (model.size - index) * sizeof(MODEL_ITEM*));
+
+    model.items[index] = item;
+    model.size++;
+
+    return ;
+}
+
+static inline MODEL_ITEM* Model_remove(size_t index) {
+
+    MODEL_ITEM* item = model.items[index];
+
+    memmove(&model.items[index], &model.items[index + 1], (model.size - index - 1) * sizeof(MODEL_ITEM*));
+    model.size--;
+
+    return item;
+}
+
+/* Takes a given element out of the model, which must hold it */
+static inline void Model_take(const MODEL_ITEM* item) {
+
+    size_t i = 0;
+
+    for (; (i < model.size) && (model.items[i] != item); i++) ;
+
+    assert(i < model.size);
+
+    Model_remove(i);
+
+    return ;
+}
+
+/* Checks that `collect` has seen exactly the elements of the model, in its order */
+static inline void Model_check_seen(void) {
+
+    assert(seen_count == model.size);
+
+    for (size_t i = 0; i < model.size; i++) {
+        assert(seen[i] == model.items[i]);
+    }
+
+    return ;
+}
+
+/* ================================ */
+
+/* Seeds `rand` from `[seed] [runs]` on the command line, the time by default, and returns the number of runs */
+static inline size_t Model_runs(int argc, char** argv, size_t runs, unsigned int* seed) {
+
+    *seed = (argc > 1) ? strtoul(argv[1], NULL, 10) : (unsigned int) time(NULL);
+
+    srand(*seed);
+
+    return (argc > 2) ? strtoull(argv[2], NULL, 10) : runs;
+}
+
+/* Empties the model for a new run */
+static inline void Model_reset(void) {
+
+    model.size = 0;
+    seen_count = 0;
+
+    return ;
+}
+
+#endif
@@ -0,0 +1,256 @@
+#include "../include/sll.h"
+
+#include <stdint.h>
+#include <limits.h>
+#include <assert.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+/*
+ * Checks a list in sync mode shared by producer and consumer threads: every item is taken exactly once, each
+ * consumer sees each producer's items in the order they were inserted, and the eventfd of the list is readable
+ * exactly while the list has elements. Consumers wait in `sList_pop_wait` in every mode: indefinitely,
+ * with a timeout they keep running out of, and not at all after `poll` reports the eventfd readable.
+ *
+ * Built under ThreadSanitizer (`make sync`), as the work container test is.
+ */
+
+#define PRODUCERS 3
+#define CONSUMERS 3
+
+/* Items each producer inserts */
+#define ITEMS 20000
+
+typedef struct {
+    size_t producer;
+    size_t sequence;    /* Position among the producer's items, `SIZE_MAX` to stop a consumer */
+} Item;
+
+static sList_t list;
+static int fd;
+
+/* How many times each item has been taken */
+static _Atomic int taken[PRODUCERS * ITEMS];
+
+/* Waits that timed out while producers were still inserting */
+static _Atomic size_t timeouts;
+
+/* ================================================================ */
+
+Item* Item_new(size_t producer, size_t sequence) {
+
+    Item* item = malloc(sizeof(Item));
+
+    assert(item != NULL);
+
+    item->producer = producer;
+    item->sequence = sequence;
+
+    return item;
+}
+
+/* Reads the counter of an eventfd without consuming it, from the kernel's description of the descriptor */
+unsigned long long Eventfd_count(void) {
+
+    char path[64];
+    char line[128];
+
+    unsigned long long count = ULLONG_MAX;
+
+    snprintf(path, sizeof(path), "/proc/self/fdinfo/%d", fd);
+
+    FILE* file = fopen(path, "r");
+
+    assert(file != NULL);
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        sscanf(line, "eventfd-count: %llx", &count);
+    }
+
+    fclose(file);
+
+    assert(count != ULLONG_MAX);
+
+    return count;
+}
+
+int Eventfd_readable(int timeout) {
+
+    struct pollfd event = {fd, POLLIN, 0};
+
+    assert(poll(&event, 1, timeout) >= 0);
+
+    return (event.revents & POLLIN) != 0;
+}
+
+/* ================================================================ */
+
+void* Producer_run(void* arg) {
+
+    size_t producer = (size_t) (uintptr_t) arg;
+
+    for (size_t i = 0; i < ITEMS; i++) {
+        assert(sList_insert_last(list, Item_new(producer, i)) == E_OK);
+
+        /* Now and then the consumers catch up and have to wait */
+        if (i % 4096 == 0) {
+            usleep(2000);
+        }
+    }
+
+    return NULL;
+}
+
+void* Consumer_run(void* arg) {
+
+    size_t consumer = (size_t) (uintptr_t) arg;
+
+    /* The next item expected from each producer is at least this one */
+    size_t next[PRODUCERS] = {0};
+
+    void* data = NULL;
+
+    int result = E_OK;
+
+    for (;;) {
+
+        switch (consumer) {
+
+            case 0:
+                result = sList_pop_wait(list, &data, -1);
+
+                assert(result == E_OK);
+
+                break ;
+
+            case 1:
+                if ((result = sList_pop_wait(list, &data, 1)) == E_TIMEOUT) {
+                    atomic_fetch_add(&timeouts, 1);
+                }
+
+                break ;
+
+            default:
+                /* Another consumer may take the element between the poll and the pop */
+                result = Eventfd_readable(10) ? sList_pop_wait(list, &data, 0) : E_TIMEOUT;
+
+                break ;
+        }
+
+        if (result == E_TIMEOUT) {
+            continue ;
+        }
+
+        assert(result == E_OK);
+
+        Item* item = data;
+
+        if (item->sequence == SIZE_MAX) {
+            free(item);
+
+            return NULL;
+        }
+
+        assert(item->sequence >= next[item->producer]);
+        assert(atomic_fetch_add(&taken[item->producer * ITEMS + item->sequence], 1) == 0);
+
+        next[item->producer] = item->sequence + 1;
+
+        free(item);
+    }
+}
+
+/* ================================================================ */
+
+int main(void) {
+
+    pthread_t producers[PRODUCERS];
+    pthread_t consumers[CONSUMERS];
+
+    struct timespec start;
+    struct timespec end;
+
+    void* data = NULL;
+    int value = 1;
+
+    assert(sList_new(&list, NULL, NULL, NULL) == E_OK);
+
+    /* Waiting needs sync mode */
+    assert(sList_pop_wait(list, &data, 0) == E_MISMET);
+
+    assert(sList_set_sync(list) == E_OK);
+    assert(sList_set_sync(list) == E_OK);
+
+    /* A timeout of 0 does not wait, a positive one waits at least that long */
+    assert(sList_pop_wait(list, &data, 0) == E_TIMEOUT);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    assert(sList_pop_wait(list, &data, 50) == E_TIMEOUT);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    assert((end.tv_sec - start.tv_sec) * 1000000000L + (end.tv_nsec - start.tv_nsec) >= 50000000L);
+
+    assert(sList_insert_last(list, &value) == E_OK);
+    assert((sList_pop_wait(list, &data, 0) == E_OK) && (data == &value));
+
+    /* Requested on a list that has elements, the eventfd starts readable; its counter stays 1 however many are added */
+    assert(sList_insert_last(list, &value) == E_OK);
+
+    assert(sList_eventfd(list, &fd) == E_OK);
+    assert(Eventfd_readable(0) && (Eventfd_count() == 1));
+
+    assert(sList_insert_first(list, &value) == E_OK);
+    assert(Eventfd_readable(0) && (Eventfd_count() == 1));
+
+    assert(sList_remove_last(list, &data) == E_OK);
+    assert(Eventfd_readable(0) && (Eventfd_count() == 1));
+
+    assert(sList_pop_wait(list, &data, -1) == E_OK);
+    assert(!Eventfd_readable(0) && (Eventfd_count() == 0));
+
+    /* The same descriptor every time */
+    int again = -1;
+
+    assert((sList_eventfd(list, &again) == E_OK) && (again == fd));
+
+    for (size_t i = 0; i < CONSUMERS; i++) {
+        assert(pthread_create(&consumers[i], NULL, Consumer_run, (void*) (uintptr_t) i) == 0);
+    }
+
+    for (size_t i = 0; i < PRODUCERS; i++) {
+        assert(pthread_create(&producers[i], NULL, Producer_run, (void*) (uintptr_t) i) == 0);
+    }
+
+    for (size_t i = 0; i < PRODUCERS; i++) {
+        pthread_join(producers[i], NULL);
+    }
+
+    /* Queued behind every item, one stop per consumer */
+    for (size_t i = 0; i < CONSUMERS; i++) {
+        assert(sList_insert_last(list, Item_new(0, SIZE_MAX)) == E_OK);
+    }
+
+    for (size_t i = 0; i < CONSUMERS; i++) {
+        pthread_join(consumers[i], NULL);
+    }
+
+    for (size_t i = 0; i < PRODUCERS * ITEMS; i++) {
+        assert(atomic_load(&taken[i]) == 1);
+    }
+
+    assert(sList_size(list) == 0);
+    assert(!Eventfd_readable(0) && (Eventfd_count() == 0));
+
+    assert(sList_destroy(&list) == E_OK);
+
+    /* The list closes its eventfd */
+    assert((fcntl(fd, F_GETFD) == -1) && (errno == EBADF));
+
+    printf("%d items taken exactly once by %d consumers (%zu timed out waits)\n", PRODUCERS * ITEMS, CONSUMERS, atomic_load(&timeouts));
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,408 @@
+#include "../include/sll.h"
+
+#include <stdint.h>
+#include <assert.h>
+
+/*
+ * Checks an expiry container against the model, which holds the pending elements with their deadlines.
+ * Directed cases come first: deadlines on both sides of every level boundary of the wheel, deadlines parked
+ * beyond its reach, cancelled elements, deadlines in the past and time jumping far ahead. Random runs then mix
+ * inserts, refreshes, cancels and expiries, with deadlines from the past to beyond the wheel's reach and time
+ * moving in jumps of every size, and check that exactly the elements whose deadline has passed expire, earlier
+ * deadlines first.
+ */
+
+/* The reach of the wheel (`SPAN` in source/ttl.c), and the span of a slot on each of its levels */
+#define SPAN ((uint64_t) 1 << 24)
+#define LEVEL(l) ((uint64_t) 1 << (6 * (l)))
+
+/* The most elements a run holds */
+#define CAPACITY 256
+
+typedef struct {
+    uint64_t deadline;  /* When the element expires: a deadline already passed when it was set is the next tick */
+    sTimer_t timer;
+} Element;
+
+#define MODEL_ITEM Element
+#define MODEL_CAPACITY CAPACITY
+
+#include "model.h"
+
+/* The elements an expiry reported, in the order it reported them */
+static Element* expired[CAPACITY];
+static size_t expired_count;
+
+static size_t destroyed;
+
+/* ================================================================ */
+
+void expire(void* data) {
+
+    assert(expired_count < CAPACITY);
+
+    expired[expired_count++] = data;
+}
+
+void destroy(void* data) {
+
+    destroyed++;
+
+    free(data);
+}
+
+Element* Element_new(uint64_t deadline) {
+
+    Element* element = malloc(sizeof(Element));
+
+    assert(element != NULL);
+
+    element->deadline = deadline;
+
+    return element;
+}
+
+/* Inserts an element expiring at a given time, as seen at time `now` */
+Element* Insert(const sTTL_t ttl, uint64_t now, uint64_t deadline) {
+
+    Element* element = Element_new((deadline > now) ? deadline : now + 1);
+
+    assert(sTTL_insert(ttl, element, deadline, &element->timer) == E_OK);
+
+    Model_insert(model.size, element);
+
+    return element;
+}
+
+/* Advances time and checks that exactly the elements due expire, in deadline order */
+void Expire(const sTTL_t ttl, uint64_t now) {
+
+    size_t due = 0;
+
+    for (size_t i = 0; i < model.size; i++) {
+        due += (model.items[i]->deadline <= now);
+    }
+
+    expired_count = 0;
+
+    assert(sTTL_expire(ttl, now) == (ssize_t) due);
+    assert(expired_count == due);
+
+    for (size_t i = 0; i < expired_count; i++) {
+        assert(expired[i]->deadline <= now);
+        assert((i + 1 == expired_count) || (expired[i]->deadline <= expired[i + 1]->deadline));
+
+        Model_take(expired[i]);
+        free(expired[i]);
+    }
+
+    assert(sTTL_size(ttl) == (ssize_t) model.size);
+
+    return ;
+}
+
+/* ================================================================ */
+
+/* Deadlines just before and at every level boundary each expire on their own tick, after cascading down */
+void Cascade(void) {
+
+    sTTL_t ttl = NULL;
+
+    uint64_t start = 1000;
+    uint64_t now = start;
+
+    assert(sTTL_new(&ttl, start, destroy, expire) == E_OK);
+
+    for (unsigned int level = 1; level <= 4; level++) {
+        Insert(ttl, now, start + LEVEL(level) - 1);
+        Insert(ttl, now, start + LEVEL(level));
+        Insert(ttl, now, start + LEVEL(level) + 1);
+    }
+
+    while (model.size > 0) {
+
+        uint64_t next = UINT64_MAX;
+
+        for (size_t i = 0; i < model.size; i++) {
+            next = (model.items[i]->deadline < next) ? model.items[i]->deadline : next;
+        }
+
+        /* Nothing one tick early, then the element on time */
+        Expire(ttl, next - 1);
+        Expire(ttl, next);
+
+        assert(expired_count == 1);
+    }
+
+    assert(sTTL_destroy(&ttl) == E_OK);
+
+    return ;
+}
+
+/* Deadlines beyond the wheel's reach are parked and placed again until they come within it */
+void Parked(void) {
+
+    sTTL_t ttl = NULL;
+
+    uint64_t now = 5;
+
+    assert(sTTL_new(&ttl, now, destroy, expire) == E_OK);
+
+    Insert(ttl, now, now + 3 * SPAN + 7);
+    Insert(ttl, now, now + SPAN);
+    Insert(ttl, now, UINT64_MAX - 1);
+
+    /* The parked element's slot comes up every `SPAN` ticks, without expiring it */
+    for (size_t i = 1; i <= 3; i++) {
+        Expire(ttl, now + i * SPAN - 1);
+        Expire(ttl, now + i * SPAN);
+    }
+
+    Expire(ttl, now + 3 * SPAN + 6);
+    assert(expired_count == 0);
+
+    Expire(ttl, now + 3 * SPAN + 7);
+    assert(expired_count == 1);
+
+    /* The last one stays until the container is destroyed */
+    destroyed = 0;
+
+    assert(sTTL_destroy(&ttl) == E_OK);
+    assert((ttl == NULL) && (destroyed == 1));
+
+    model.size = 0;
+
+    return ;
+}
+
+/* A cancelled element is handed back and never expires */
+void Cancel(void) {
+
+    sTTL_t ttl = NULL;
+
+    void* data = NULL;
+
+    assert(sTTL_new(&ttl, 0, destroy, expire) == E_OK);
+
+    Element* near = Insert(ttl, 0, 10);
+    Element* far = Insert(ttl, 0, 10 * LEVEL(2));
+    Element* kept = Insert(ttl, 0, 10);
+
+    assert((sTTL_cancel(ttl, near->timer, &data) == E_OK) && (data == near));
+    assert((sTTL_cancel(ttl, far->timer, &data) == E_OK) && (data == far));
+    assert(sTTL_cancel(ttl, NULL, &data) == E_NULL_V);
+
+    Model_take(near);
+    Model_take(far);
+
+    free(near);
+    free(far);
+
+    Expire(ttl, 20 * LEVEL(2));
+    assert((expired_count == 1) && (expired[0] == kept));
+
+    assert(sTTL_destroy(&ttl) == E_OK);
+
+    return ;
+}
+
+/* Deadlines that have passed, or that are now, expire on the next tick and not before */
+void Past(void) {
+
+    sTTL_t ttl = NULL;
+
+    uint64_t now = 70000;
+
+    assert(sTTL_new(&ttl, now, destroy, expire) == E_OK);
+
+    Insert(ttl, now, 0);
+    Insert(ttl, now, now - 64);
+    Insert(ttl, now, now);
+
+    Expire(ttl, now);
+    assert(expired_count == 0);
+
+    Expire(ttl, now + 1);
+    assert(expired_count == 3);
+
+    /* The same holds for a deadline refreshed into the past */
+    Element* element = Insert(ttl, now + 1, now + 1000);
+
+    assert(sTTL_refresh(ttl, element->timer, 1) == E_OK);
+    element->deadline = now + 2;
+
+    Expire(ttl, now + 2);
+    assert(expired_count == 1);
+
+    assert(sTTL_destroy(&ttl) == E_OK);
+
+    return ;
+}
+
+/*
+ * Time jumping far ahead costs a step per cascade that brings an element down, not per slot of the lowest level
+ * passed on the way: an element parked 2^40 ticks out takes a few thousand steps to reach, where a walk of the
+ * lowest level would take billions.
+ */
+void Jump(void) {
+
+    sTTL_t ttl = NULL;
+
+    struct timespec start;
+    struct timespec end;
+
+    uint64_t far = (uint64_t) 1 << 40;
+
+    assert(sTTL_new(&ttl, 0, destroy, expire) == E_OK);
+
+    Insert(ttl, 0, far);
+    Insert(ttl, 0, far + LEVEL(1) + 1);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    Expire(ttl, far >> 4);
+    Expire(ttl, far - 1);
+    Expire(ttl, far);
+    assert(expired_count == 1);
+
+    Expire(ttl, UINT64_MAX >> 1);
+    assert(expired_count == 1);
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    assert(end.tv_sec - start.tv_sec < 2);
+
+    assert(sTTL_destroy(&ttl) == E_OK);
+
+    return ;
+}
+
+/* ================================================================ */
+
+/* A deadline from the past to beyond the wheel's reach, mostly within a few slots of the levels */
+uint64_t Deadline(uint64_t now) {
+
+    switch (rand() % 8) {
+        case 0:  return now - rand() % 100;
+        case 1:  return now + rand() % LEVEL(1);
+        case 2:  return now + rand() % LEVEL(2);
+        case 3:  return now + rand() % LEVEL(3);
+        case 4:  return now + rand() % (2 * LEVEL(3));
+        case 5:  return now + rand() % LEVEL(4);
+        case 6:  return now + LEVEL(1) * (rand() % 4) + rand() % 3 - 1;
+        default: return now + (uint64_t) rand() % (2 * SPAN);
+    }
+}
+
+/* How far time moves in one expiry */
+uint64_t Step(void) {
+
+    switch (rand() % 4) {
+        case 0:  return rand() % 4;
+        case 1:  return rand() % LEVEL(1);
+        case 2:  return rand() % LEVEL(2);
+        default: return rand() % LEVEL(3);
+    }
+}
+
+void Run(const sTTL_t ttl, uint64_t now, size_t steps) {
+
+    void* data = NULL;
+
+    for (size_t s = 0; s < steps; s++) {
+
+        int operation = rand() % 8;
+
+        if ((model.size == CAPACITY) && (operation < 3)) {
+            operation = 7;
+        }
+
+        switch (operation) {
+
+            case 0:
+            case 1:
+            case 2:
+                Insert(ttl, now, Deadline(now));
+
+                break ;
+
+            case 3:
+            case 4: {
+                if (model.size == 0) {
+                    break ;
+                }
+
+                Element* element = model.items[rand() % model.size];
+                uint64_t deadline = Deadline(now);
+
+                assert(sTTL_refresh(ttl, element->timer, deadline) == E_OK);
+                element->deadline = (deadline > now) ? deadline : now + 1;
+
+                break ;
+            }
+
+            case 5: {
+                if (model.size == 0) {
+                    break ;
+                }
+
+                Element* element = model.items[rand() % model.size];
+
+                assert((sTTL_cancel(ttl, element->timer, &data) == E_OK) && (data == element));
+
+                Model_take(element);
+                free(element);
+
+                break ;
+            }
+
+            default:
+                now += Step();
+
+                Expire(ttl, now);
+
+                break ;
+        }
+    }
+
+    return ;
+}
+
+/* ================================================================ */
+
+int main(int argc, char** argv) {
+
+    sTTL_t ttl = NULL;
+
+    unsigned int seed = 0;
+    size_t runs = Model_runs(argc, argv, 200, &seed);
+
+    Cascade();
+    Parked();
+    Cancel();
+    Past();
+    Jump();
+
+    for (size_t r = 0; r < runs; r++) {
+
+        /* Starting anywhere, so the wheel's levels are not aligned with the first tick */
+        uint64_t now = (uint64_t) rand() * rand();
+
+        Model_reset();
+        destroyed = 0;
+
+        assert(sTTL_new(&ttl, now, destroy, expire) == E_OK);
+
+        Run(ttl, now, rand() % 1024);
+
+        /* Destroying the container destroys what is left in it */
+        size_t left = model.size;
+
+        assert(sTTL_destroy(&ttl) == E_OK);
+        assert((ttl == NULL) && (destroyed == left));
+    }
+
+    printf("%zu runs passed (seed %u)\n", runs, seed);
+
+    return EXIT_SUCCESS;
+}
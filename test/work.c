@@ -0,0 +1,183 @@
+#include "../include/sll.h"
+
+#include <stdint.h>
+#include <assert.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+/*
+ * Runs workers that push, pop and steal from a work container, next to thieves that only steal, and checks
+ * that every item is taken exactly once. Workers mostly keep their deques at zero or one item, so the owner
+ * and the thieves keep racing for the last item; now and then a worker pushes a burst that makes its deque grow.
+ *
+ * Built under ThreadSanitizer (`make work`): each item is written by the worker that pushes it and read by
+ * whichever thread takes it, so an item published without the right ordering is reported.
+ */
+
+#define WORKERS 4
+#define THIEVES 2
+
+/* Items each worker pushes */
+#define ITEMS 20000
+
+typedef struct {
+    size_t id;
+    size_t check;   /* Written before the item is pushed, read by the thread that takes it */
+} Item;
+
+static sWork_t work;
+
+/* How many times each item has been taken */
+static _Atomic int taken[WORKERS * ITEMS];
+static _Atomic size_t consumed;
+
+/* Items destroyed with the container */
+static size_t destroyed;
+
+/* ================================================================ */
+
+void Item_take(void* data) {
+
+    Item* item = data;
+
+    assert(item->check == item->id * 7 + 1);
+    assert(atomic_fetch_add(&taken[item->id], 1) == 0);
+
+    free(item);
+
+    atomic_fetch_add(&consumed, 1);
+
+    return ;
+}
+
+void Item_destroy(void* data) {
+
+    destroyed++;
+
+    free(data);
+}
+
+Item* Item_new(size_t id) {
+
+    Item* item = malloc(sizeof(Item));
+
+    assert(item != NULL);
+
+    item->id = id;
+    item->check = id * 7 + 1;
+
+    return item;
+}
+
+/* ================================================================ */
+
+void* Worker_run(void* arg) {
+
+    size_t worker = (size_t) (uintptr_t) arg;
+    size_t pushed = 0;
+
+    unsigned int seed = (unsigned int) worker;
+
+    void* data = NULL;
+
+    while (atomic_load(&consumed) < WORKERS * ITEMS) {
+
+        /* Mostly one item at a time, sometimes a burst larger than a deque starts with */
+        size_t burst = (rand_r(&seed) % 64 == 0) ? 200 : 1;
+
+        for (size_t i = 0; (i < burst) && (pushed < ITEMS); i++, pushed++) {
+            assert(sWork_push(work, worker, Item_new(worker * ITEMS + pushed)) == E_OK);
+        }
+
+        if (sWork_pop(work, worker, &data) == E_OK) {
+            Item_take(data);
+        }
+        else if (sWork_steal(work, worker, &data) == E_OK) {
+            Item_take(data);
+        }
+    }
+
+    return NULL;
+}
+
+void* Thief_run(void* arg) {
+
+    void* data = NULL;
+
+    (void) arg;
+
+    while (atomic_load(&consumed) < WORKERS * ITEMS) {
+
+        /* Not a worker: every deque is a victim */
+        if (sWork_steal(work, WORKERS, &data) == E_OK) {
+            Item_take(data);
+        }
+    }
+
+    return NULL;
+}
+
+/* ================================================================ */
+
+int main(void) {
+
+    pthread_t threads[WORKERS + THIEVES];
+
+    void* data = NULL;
+
+    assert(sWork_new(&work, 0, Item_destroy) == E_INVAL);
+    assert(sWork_new(&work, WORKERS, Item_destroy) == E_OK);
+
+    /* An owner takes its items back last in, first out; a thief takes them first in, first out */
+    for (size_t i = 0; i < 3; i++) {
+        assert(sWork_push(work, 0, Item_new(i)) == E_OK);
+    }
+
+    assert(sWork_size(work) == 3);
+
+    assert((sWork_pop(work, 0, &data) == E_OK) && (((Item*) data)->id == 2));
+    free(data);
+
+    assert((sWork_steal(work, 1, &data) == E_OK) && (((Item*) data)->id == 0));
+    free(data);
+
+    /* A worker does not steal from itself */
+    assert(sWork_steal(work, 0, &data) == E_NOTFOUND);
+
+    assert((sWork_pop(work, 0, &data) == E_OK) && (((Item*) data)->id == 1));
+    free(data);
+
+    assert(sWork_pop(work, 0, &data) == E_NOTFOUND);
+    assert(sWork_push(work, WORKERS, &data) == E_INVAL);
+    assert(sWork_pop(work, WORKERS, &data) == E_INVAL);
+
+    for (size_t i = 0; i < WORKERS; i++) {
+        assert(pthread_create(&threads[i], NULL, Worker_run, (void*) (uintptr_t) i) == 0);
+    }
+
+    for (size_t i = 0; i < THIEVES; i++) {
+        assert(pthread_create(&threads[WORKERS + i], NULL, Thief_run, NULL) == 0);
+    }
+
+    for (size_t i = 0; i < WORKERS + THIEVES; i++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    for (size_t i = 0; i < WORKERS * ITEMS; i++) {
+        assert(atomic_load(&taken[i]) == 1);
+    }
+
+    assert(sWork_size(work) == 0);
+
+    /* Items left in the container are destroyed with it */
+    for (size_t i = 0; i < 100; i++) {
+        assert(sWork_push(work, i % WORKERS, Item_new(i)) == E_OK);
+    }
+
+    assert(sWork_destroy(&work) == E_OK);
+    assert((work == NULL) && (destroyed == 100));
+
+    printf("%d items taken exactly once by %d workers and %d thieves\n", WORKERS * ITEMS, WORKERS, THIEVES);
+
+    return EXIT_SUCCESS;
+}